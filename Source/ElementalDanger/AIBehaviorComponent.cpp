@@ -3,13 +3,27 @@
 #include "AIBehaviorComponent.h"
 #include "CombatEntity.h"
 #include "NinjaWizardCharacter.h"
-#include "SafeZoneVolume.h"
+#include "SafeZoneSubsystem.h"
+#include "AITickManagerSubsystem.h"
+#include "CombatSpatialHashSubsystem.h"
+#include "AIProximitySubsystem.h"
+#include "VegetationSubsystem.h"
+#include "AIFlockingSubsystem.h"
+#include "AIGroup.h"
+#include "AIMassSubsystem.h"
+#include "AINavigationSubsystem.h"
+#include "AIFlowFieldSubsystem.h"
+#include "AIWanderPointSubsystem.h"
+#include "AIThreatMapSubsystem.h"
+#include "AITerritorySubsystem.h"
 #include "AIController.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "NavigationSystem.h"
 #include "DrawDebugHelpers.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
 
 UAIBehaviorComponent::UAIBehaviorComponent()
 {
@@ -18,16 +32,25 @@ UAIBehaviorComponent::UAIBehaviorComponent()
 	BehaviorType = EAIBehaviorType::Passive;
 	CurrentState = EAIState::Idle;
 
-	CurrentStamina = 100.0f;
-	TimeSinceLastAction = 0.0f;
-	TimeSinceLastWander = 0.0f;
-	TimeSinceLastEat = 0.0f;
+	HotState = &LocalHotState;
+	TickManager = nullptr;
+	ProximitySubsystem = nullptr;
+	FlockingSubsystem = nullptr;
+	MassSubsystem = nullptr;
+	NavigationSubsystem = nullptr;
+	FlowFieldSubsystem = nullptr;
+	WanderPointSubsystem = nullptr;
+	ThreatMapSubsystem = nullptr;
+	TerritorySubsystem = nullptr;
+	Group = nullptr;
+}
+
+namespace
+{
+	const FName AwarenessRingName(TEXT("Awareness"));
 
-	bIsInCombat = false;
-	bIsFleeing = false;
-	bIsExhausted = false;
-	bCheesingSeen = false;
-	bInSafeZone = false;
+	// Flee targets closer than this count as reached and are replaced
+	constexpr float FleeTargetReachedDistance = 150.0f;
 }
 
 void UAIBehaviorComponent::BeginPlay()
@@ -41,6 +64,11 @@ void UAIBehaviorComponent::BeginPlay()
 		SpawnLocation = OwnerEntity->GetActorLocation();
 	}
 
+	NavigationSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UAINavigationSubsystem>() : nullptr;
+	FlowFieldSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UAIFlowFieldSubsystem>() : nullptr;
+	WanderPointSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UAIWanderPointSubsystem>() : nullptr;
+	ThreatMapSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UAIThreatMapSubsystem>() : nullptr;
+
 	// Set territory center to spawn location for area guards
 	if (BehaviorType == EAIBehaviorType::AreaGuard)
 	{
@@ -50,13 +78,78 @@ void UAIBehaviorComponent::BeginPlay()
 		}
 	}
 
+	TerritorySubsystem = GetWorld() ? GetWorld()->GetSubsystem<UAITerritorySubsystem>() : nullptr;
+	RefreshTerritory();
+
 	// Initialize stamina for chasing mobs
 	if (BehaviorType == EAIBehaviorType::Chasing)
 	{
-		CurrentStamina = ChasingSettings.MaxStamina;
+		HotState->CurrentStamina = ChasingSettings.MaxStamina;
+	}
+
+	// Hand ticking over to the batched AI tick manager when available
+	TickManager = GetWorld() ? GetWorld()->GetSubsystem<UAITickManagerSubsystem>() : nullptr;
+	if (TickManager)
+	{
+		TickManager->RegisterBehavior(this);
+	}
+
+	// Players entering or leaving the awareness radius arrive as events
+	ProximitySubsystem = GetWorld() ? GetWorld()->GetSubsystem<UAIProximitySubsystem>() : nullptr;
+	RefreshProximityRings();
+
+	FlockingSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UAIFlockingSubsystem>() : nullptr;
+	JoinLeaderFlock();
+
+	MassSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UAIMassSubsystem>() : nullptr;
+	if (MassSubsystem && bAllowMassRepresentation && UAIMassSubsystem::SupportsBehaviorType(BehaviorType))
+	{
+		MassSubsystem->RegisterRepresentable(this);
 	}
 }
 
+void UAIBehaviorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (TickManager)
+	{
+		TickManager->UnregisterBehavior(this);
+		TickManager = nullptr;
+	}
+
+	if (ProximitySubsystem)
+	{
+		ProximitySubsystem->UnsubscribeAgent(OwnerEntity);
+		ProximitySubsystem = nullptr;
+	}
+	bUsesProximityRings = false;
+	PlayersInAwareness.Empty();
+
+	ReleaseVegetation();
+	LeaveGroup();
+	FlockingSubsystem = nullptr;
+
+	if (MassSubsystem)
+	{
+		MassSubsystem->UnregisterRepresentable(this);
+		MassSubsystem = nullptr;
+	}
+	NavigationSubsystem = nullptr;
+
+	StopPursuit();
+	FlowFieldSubsystem = nullptr;
+	WanderPointSubsystem = nullptr;
+	ThreatMapSubsystem = nullptr;
+
+	if (TerritorySubsystem && TerritoryId != INDEX_NONE)
+	{
+		TerritorySubsystem->UnregisterGuard(OwnerEntity, TerritoryId);
+	}
+	TerritoryId = INDEX_NONE;
+	TerritorySubsystem = nullptr;
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UAIBehaviorComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -83,7 +176,7 @@ void UAIBehaviorComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
 			break;
 	}
 
-	TimeSinceLastAction += DeltaTime;
+	HotState->TimeSinceLastAction += DeltaTime;
 }
 
 // ============================================
@@ -93,16 +186,99 @@ void UAIBehaviorComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
 void UAIBehaviorComponent::SetBehaviorType(EAIBehaviorType NewType)
 {
 	BehaviorType = NewType;
-	SetState(EAIState::Idle);
+
+	// Move to the matching per-type bucket
+	if (TickManager)
+	{
+		TickManager->RefreshBehaviorType(this);
+	}
+
+	RefreshProximityRings();
+	RefreshTerritory();
+
+	// Only some behavior types have a Mass representation
+	if (MassSubsystem)
+	{
+		if (bAllowMassRepresentation && UAIMassSubsystem::SupportsBehaviorType(BehaviorType))
+		{
+			MassSubsystem->RegisterRepresentable(this);
+		}
+		else
+		{
+			MassSubsystem->UnregisterRepresentable(this);
+		}
+	}
+
+	SetStateWithReason(EAIState::Idle, TEXT("BehaviorTypeChanged"));
 }
 
 void UAIBehaviorComponent::SetState(EAIState NewState)
 {
+	SetStateWithReason(NewState, TEXT("Blueprint"));
+}
+
+void UAIBehaviorComponent::ApplyStateTransition(EAIState NewState, const TCHAR* Reason)
+{
+	// Behaviors re-assert their state every update, only real transitions reach Blueprint
+	if (NewState == CurrentState)
+	{
+		++NumRedundantStateChanges;
+		return;
+	}
+
 	EAIState OldState = CurrentState;
 	CurrentState = NewState;
+
+	FAIStateTransition& Entry = StateJournal[StateJournalHead];
+	Entry.Time = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	Entry.OldState = OldState;
+	Entry.NewState = NewState;
+	Entry.Reason = Reason;
+	StateJournalHead = (StateJournalHead + 1) % StateJournalSize;
+	StateJournalCount = FMath::Min(StateJournalCount + 1, StateJournalSize);
+
+	if (NewState != EAIState::Chasing && NewState != EAIState::Attacking)
+	{
+		StopPursuit();
+	}
+
 	OnStateChanged(OldState, NewState);
 }
 
+void UAIBehaviorComponent::DumpStateJournal() const
+{
+	UE_LOG(LogTemp, Log, TEXT("%s: %s, %d transitions journaled, %d redundant SetState calls"),
+		*GetNameSafe(GetOwner()), *UEnum::GetValueAsString(CurrentState), StateJournalCount, NumRedundantStateChanges);
+
+	const int32 First = (StateJournalHead - StateJournalCount + StateJournalSize) % StateJournalSize;
+	for (int32 i = 0; i < StateJournalCount; i++)
+	{
+		const FAIStateTransition& Entry = StateJournal[(First + i) % StateJournalSize];
+		UE_LOG(LogTemp, Log, TEXT("  %8.2f  %s -> %s  (%s)"), Entry.Time,
+			*UEnum::GetValueAsString(Entry.OldState), *UEnum::GetValueAsString(Entry.NewState), Entry.Reason);
+	}
+}
+
+namespace
+{
+	// ai.DumpStateJournal [ActorNameFilter]
+	FAutoConsoleCommandWithWorldAndArgs DumpStateJournalCommand(
+		TEXT("ai.DumpStateJournal"),
+		TEXT("Logs the recent state transitions of every AI agent, optionally only those whose actor name contains the argument"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			const FString Filter = Args.Num() > 0 ? Args[0] : FString();
+
+			for (TObjectIterator<UAIBehaviorComponent> It; It; ++It)
+			{
+				if (It->GetWorld() != World || !It->GetOwner()) continue;
+				if (!Filter.IsEmpty() && !It->GetOwner()->GetName().Contains(Filter)) continue;
+
+				It->DumpStateJournal();
+			}
+		}));
+}
+
 // ============================================
 // Passive Behavior Implementation
 // ============================================
@@ -111,43 +287,67 @@ void UAIBehaviorComponent::UpdatePassiveBehavior(float DeltaTime)
 {
 	if (!OwnerEntity) return;
 
+	HotState->TimeSinceLastMeal += DeltaTime;
+
 	// Check for threats if can flee
 	if (PassiveSettings.bCanFlee)
 	{
-		ANinjaWizardCharacter* Player = FindNearestPlayer();
-		if (Player && GetDistanceToPlayer(Player) < PassiveSettings.FleeDistance)
+		if (ANinjaWizardCharacter* Player = FindPlayerInAwareness())
 		{
 			FleeFromThreat(Player);
 			return;
 		}
 	}
 
+	// Threat out of awareness, back to grazing
+	if (HotState->bIsFleeing)
+	{
+		HotState->bIsFleeing = false;
+		SetStateWithReason(EAIState::Idle, TEXT("ThreatLost"));
+	}
+
 	// State machine for passive behavior
 	switch (CurrentState)
 	{
 		case EAIState::Idle:
-			TimeSinceLastWander += DeltaTime;
-			if (TimeSinceLastWander >= PassiveSettings.WanderInterval)
+			HotState->TimeSinceLastWander += DeltaTime;
+			if (HotState->TimeSinceLastWander >= PassiveSettings.WanderInterval)
 			{
-				StartWandering();
-				TimeSinceLastWander = 0.0f;
+				// Hungry mobs head for food instead of wandering
+				if (HotState->TimeSinceLastMeal >= PassiveSettings.EatingInterval)
+				{
+					LookForVegetation();
+				}
+				if (!CurrentVegetation)
+				{
+					StartWandering();
+				}
+				HotState->TimeSinceLastWander = 0.0f;
 			}
 			break;
 
 		case EAIState::Wandering:
+			// Start grazing once next to the reserved vegetation
+			if (CurrentVegetation && FVector::Dist(OwnerEntity->GetActorLocation(), CurrentVegetation->GetActorLocation()) < 150.0f)
+			{
+				StartEating(CurrentVegetation);
+			}
 			// Check if reached destination
-			if (FVector::Dist(OwnerEntity->GetActorLocation(), WanderTarget) < 100.0f)
+			else if (FVector::Dist(OwnerEntity->GetActorLocation(), WanderTarget) < 100.0f)
 			{
-				SetState(EAIState::Idle);
+				ReleaseVegetation();
+				SetStateWithReason(EAIState::Idle, TEXT("ReachedWanderTarget"));
 			}
 			break;
 
 		case EAIState::Eating:
-			TimeSinceLastEat += DeltaTime;
-			if (TimeSinceLastEat >= 5.0f) // Eat for 5 seconds
+			HotState->TimeSinceLastEat += DeltaTime;
+			if (HotState->TimeSinceLastEat >= 5.0f) // Eat for 5 seconds
 			{
-				SetState(EAIState::Idle);
-				TimeSinceLastEat = 0.0f;
+				ReleaseVegetation();
+				SetStateWithReason(EAIState::Idle, TEXT("FinishedEating"));
+				HotState->TimeSinceLastEat = 0.0f;
+				HotState->TimeSinceLastMeal = 0.0f;
 			}
 			break;
 
@@ -167,15 +367,24 @@ void UAIBehaviorComponent::StartWandering()
 
 	WanderTarget = GetRandomLocationInRadius(SpawnLocation, PassiveSettings.WanderRadius);
 	MoveToLocation(WanderTarget);
-	SetState(EAIState::Wandering);
+	SetStateWithReason(EAIState::Wandering, TEXT("StartWandering"));
 }
 
 void UAIBehaviorComponent::LookForVegetation()
 {
-	CurrentVegetation = FindNearestVegetation();
+	ReleaseVegetation();
+
+	// Reserve so the rest of the herd picks other bushes
+	UVegetationSubsystem* VegetationSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UVegetationSubsystem>() : nullptr;
+	if (!VegetationSubsystem || !OwnerEntity) return;
+
+	CurrentVegetation = VegetationSubsystem->FindAndReserveNearestVegetation(OwnerEntity->GetActorLocation(),
+		PassiveSettings.PreferredVegetationTags, PassiveSettings.VegetationSearchRadius, this);
 	if (CurrentVegetation)
 	{
-		MoveToLocation(CurrentVegetation->GetActorLocation());
+		WanderTarget = CurrentVegetation->GetActorLocation();
+		MoveToLocation(WanderTarget);
+		SetStateWithReason(EAIState::Wandering, TEXT("FoundVegetation"));
 	}
 }
 
@@ -183,29 +392,40 @@ void UAIBehaviorComponent::StartEating(AActor* Vegetation)
 {
 	if (!Vegetation) return;
 
+	// Eating something other than what was reserved, e.g. when called from Blueprint
+	if (Vegetation != CurrentVegetation)
+	{
+		ReleaseVegetation();
+		if (UVegetationSubsystem* VegetationSubsystem = GetWorld()->GetSubsystem<UVegetationSubsystem>())
+		{
+			VegetationSubsystem->ReserveVegetation(Vegetation, this);
+		}
+	}
+
 	CurrentVegetation = Vegetation;
 	StopMovement();
-	SetState(EAIState::Eating);
+	SetStateWithReason(EAIState::Eating, TEXT("StartEating"));
 	RotateTowards(Vegetation, 1.0f);
 }
 
 void UAIBehaviorComponent::StartResting()
 {
 	StopMovement();
-	SetState(EAIState::Resting);
+	SetStateWithReason(EAIState::Resting, TEXT("StartResting"));
 }
 
 void UAIBehaviorComponent::FleeFromThreat(AActor* Threat)
 {
 	if (!Threat || !OwnerEntity) return;
 
-	// Calculate flee direction (away from threat)
-	FVector FleeDirection = (OwnerEntity->GetActorLocation() - Threat->GetActorLocation()).GetSafeNormal();
-	FVector FleeLocation = OwnerEntity->GetActorLocation() + (FleeDirection * PassiveSettings.FleeDistance);
+	ReleaseVegetation();
 
-	MoveToLocation(FleeLocation);
-	SetState(EAIState::Fleeing);
-	bIsFleeing = true;
+	if (UpdateFleeTarget(Threat, PassiveSettings.FleeDistance))
+	{
+		MoveToLocation(FleeTarget);
+	}
+	SetStateWithReason(EAIState::Fleeing, TEXT("FleeFromThreat"));
+	HotState->bIsFleeing = true;
 }
 
 // ============================================
@@ -232,7 +452,7 @@ void UAIBehaviorComponent::UpdateChasingBehavior(float DeltaTime)
 		// Flee from player
 		if (DistanceToPlayer <= ChasingSettings.DetectionRadius)
 		{
-			if (!bIsExhausted)
+			if (!HotState->bIsExhausted)
 			{
 				FleeFromPlayer(TargetPlayer);
 				DrainStamina(DeltaTime);
@@ -241,7 +461,7 @@ void UAIBehaviorComponent::UpdateChasingBehavior(float DeltaTime)
 			{
 				// Too exhausted to run
 				StopMovement();
-				SetState(EAIState::Idle);
+				SetStateWithReason(EAIState::Idle, TEXT("Exhausted"));
 			}
 		}
 	}
@@ -250,40 +470,40 @@ void UAIBehaviorComponent::UpdateChasingBehavior(float DeltaTime)
 		// Wander when no player nearby
 		if (CurrentState == EAIState::Idle)
 		{
-			TimeSinceLastWander += DeltaTime;
-			if (TimeSinceLastWander >= 3.0f)
+			HotState->TimeSinceLastWander += DeltaTime;
+			if (HotState->TimeSinceLastWander >= 3.0f)
 			{
 				StartWandering();
-				TimeSinceLastWander = 0.0f;
+				HotState->TimeSinceLastWander = 0.0f;
 			}
 		}
 	}
 
 	// Restore stamina when not fleeing
-	if (CurrentState != EAIState::Fleeing && CurrentStamina < ChasingSettings.MaxStamina)
+	if (CurrentState != EAIState::Fleeing && HotState->CurrentStamina < ChasingSettings.MaxStamina)
 	{
-		CurrentStamina = FMath::Min(CurrentStamina + (DeltaTime * 5.0f), ChasingSettings.MaxStamina);
-		if (CurrentStamina >= ChasingSettings.MaxStamina * 0.5f)
+		HotState->CurrentStamina = FMath::Min(HotState->CurrentStamina + (DeltaTime * 5.0f), ChasingSettings.MaxStamina);
+		if (HotState->CurrentStamina >= ChasingSettings.MaxStamina * 0.5f)
 		{
-			bIsExhausted = false;
+			HotState->bIsExhausted = false;
 		}
 	}
 }
 
 void UAIBehaviorComponent::DetectPlayer()
 {
-	TargetPlayer = FindNearestPlayer();
+	TargetPlayer = FindPlayerInAwareness();
 }
 
 void UAIBehaviorComponent::FleeFromPlayer(ANinjaWizardCharacter* Player)
 {
 	if (!Player || !OwnerEntity) return;
 
-	FVector FleeDirection = (OwnerEntity->GetActorLocation() - Player->GetActorLocation()).GetSafeNormal();
-	FVector FleeLocation = OwnerEntity->GetActorLocation() + (FleeDirection * 500.0f);
-
-	MoveToLocation(FleeLocation);
-	SetState(EAIState::Fleeing);
+	if (UpdateFleeTarget(Player, 500.0f))
+	{
+		MoveToLocation(FleeTarget);
+	}
+	SetStateWithReason(EAIState::Fleeing, TEXT("FleeFromPlayer"));
 
 	// Increase movement speed while fleeing
 	if (UCharacterMovementComponent* Movement = OwnerEntity->GetCharacterMovement())
@@ -314,17 +534,17 @@ void UAIBehaviorComponent::OnCaught(ANinjaWizardCharacter* Player)
 
 void UAIBehaviorComponent::DrainStamina(float DeltaTime)
 {
-	CurrentStamina = FMath::Max(CurrentStamina - (ChasingSettings.StaminaDrainRate * DeltaTime), 0.0f);
+	HotState->CurrentStamina = FMath::Max(HotState->CurrentStamina - (ChasingSettings.StaminaDrainRate * DeltaTime), 0.0f);
 
-	if (CurrentStamina <= 0.0f)
+	if (HotState->CurrentStamina <= 0.0f)
 	{
-		bIsExhausted = true;
+		HotState->bIsExhausted = true;
 	}
 }
 
 bool UAIBehaviorComponent::IsExhausted() const
 {
-	return bIsExhausted;
+	return HotState->bIsExhausted;
 }
 
 // ============================================
@@ -336,29 +556,54 @@ void UAIBehaviorComponent::UpdateNeutralBehavior(float DeltaTime)
 	if (!OwnerEntity) return;
 
 	// Maintain group cohesion if in a group
-	if (NeutralSettings.GroupType != EGroupBehavior::Solo && GroupMembers.Num() > 0)
+	if (NeutralSettings.GroupType != EGroupBehavior::Solo && Group)
 	{
 		MaintainGroupCohesion();
 	}
 
+	// The fight ends when the target dies or runs off, or when the pack's alert against it lapses
+	if (HotState->bIsInCombat)
+	{
+		const bool bTargetGone = !IsValid(TargetPlayer) || TargetPlayer->IsDead() ||
+			GetDistanceToPlayer(TargetPlayer) > NeutralSettings.GroupAlertLeashRadius;
+		const bool bAlertLapsed = Group && TargetPlayer && Group->GetSharedTarget() == TargetPlayer && !Group->IsAlerted();
+		if (bTargetGone || bAlertLapsed)
+		{
+			HotState->bIsInCombat = false;
+			TargetPlayer = nullptr;
+			StopMovement();
+			SetStateWithReason(EAIState::Idle, TEXT("TargetLost"));
+		}
+	}
+
+	// A packmate was attacked or called for help, members that join later only answer a live alert
+	if (Group)
+	{
+		Group->ClearLapsedAlert();
+	}
+	if (!HotState->bIsInCombat && Group && Group->IsAlerted())
+	{
+		JoinFight(Group->GetSharedTarget());
+	}
+
 	// Check for aggro only if attacked
-	if (bIsInCombat)
+	if (HotState->bIsInCombat)
 	{
 		if (TargetPlayer)
 		{
-			SetState(EAIState::Attacking);
+			SetStateWithReason(EAIState::Attacking, TEXT("InCombat"));
 		}
 	}
 	else
 	{
-		// Peaceful wandering
-		if (CurrentState == EAIState::Idle)
+		// Peaceful wandering, flock members follow their leader instead
+		if (CurrentState == EAIState::Idle && !IsFlockingMember())
 		{
-			TimeSinceLastWander += DeltaTime;
-			if (TimeSinceLastWander >= 5.0f)
+			HotState->TimeSinceLastWander += DeltaTime;
+			if (HotState->TimeSinceLastWander >= 5.0f)
 			{
 				StartWandering();
-				TimeSinceLastWander = 0.0f;
+				HotState->TimeSinceLastWander = 0.0f;
 			}
 		}
 	}
@@ -366,19 +611,40 @@ void UAIBehaviorComponent::UpdateNeutralBehavior(float DeltaTime)
 
 void UAIBehaviorComponent::FormGroup(TArray<AActor*> NearbyAllies)
 {
-	GroupMembers = NearbyAllies;
+	if (!Group)
+	{
+		JoinGroup(NewObject<UAIGroup>(this));
+	}
+
+	// Allies reference the same group object instead of copying the member list
+	for (AActor* Ally : NearbyAllies)
+	{
+		UAIBehaviorComponent* AllyBehavior = Ally ? Ally->FindComponentByClass<UAIBehaviorComponent>() : nullptr;
+		if (AllyBehavior && AllyBehavior != this)
+		{
+			AllyBehavior->JoinGroup(Group);
+		}
+	}
 
 	// First in array becomes leader
-	if (GroupMembers.Num() > 0 && !GroupLeader)
+	if (NearbyAllies.Num() > 0 && Group->HasMember(NearbyAllies[0]) && Group->GetLeader() == OwnerEntity)
 	{
-		GroupLeader = GroupMembers[0];
+		Group->SetLeader(NearbyAllies[0]);
 	}
 }
 
 void UAIBehaviorComponent::MaintainGroupCohesion()
 {
+	AActor* GroupLeader = GetGroupLeader();
 	if (!GroupLeader || !OwnerEntity) return;
 
+	// Steered as part of the flock, paused while fighting
+	if (IsFlockingMember())
+	{
+		FlockingSubsystem->SetMemberActive(OwnerEntity, !HotState->bIsInCombat);
+		return;
+	}
+
 	float DistanceToLeader = FVector::Dist(OwnerEntity->GetActorLocation(), GroupLeader->GetActorLocation());
 
 	// Stay within cohesion radius
@@ -393,10 +659,16 @@ void UAIBehaviorComponent::OnAttackedByPlayer(ANinjaWizardCharacter* Player)
 	if (!Player) return;
 
 	TargetPlayer = Player;
-	bIsInCombat = true;
-	SetState(EAIState::Attacking);
+	HotState->bIsInCombat = true;
+	SetStateWithReason(EAIState::Attacking, TEXT("AttackedByPlayer"));
 	OnEnteredCombat(Player);
 
+	// The whole pack fights back
+	if (Group)
+	{
+		Group->RaiseAlert(Player, NeutralSettings.GroupAlertDuration, NeutralSettings.GroupAlertLeashRadius);
+	}
+
 	// Call for help if enabled
 	if (NeutralSettings.bCallForHelp)
 	{
@@ -408,45 +680,54 @@ void UAIBehaviorComponent::CallForHelp()
 {
 	if (!OwnerEntity) return;
 
-	TArray<FHitResult> HitResults;
-	FVector Location = OwnerEntity->GetActorLocation();
+	// Packmates see the group alert, only unrelated allies in range need a direct call
+	if (Group && TargetPlayer)
+	{
+		Group->RaiseAlert(TargetPlayer, NeutralSettings.GroupAlertDuration, NeutralSettings.GroupAlertLeashRadius);
+	}
+
+	UCombatSpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHashSubsystem>();
+	if (!SpatialHash || !TargetPlayer) return;
+
+	FCombatEntityQueryFilter Filter;
+	Filter.IgnoredActor = OwnerEntity;
 
-	FCollisionShape Sphere = FCollisionShape::MakeSphere(NeutralSettings.HelpCallRadius);
-	GetWorld()->SweepMultiByChannel(HitResults, Location, Location, FQuat::Identity,
-		ECC_Pawn, Sphere);
+	TArray<AActor*> Allies;
+	SpatialHash->QuerySphere(OwnerEntity->GetActorLocation(), NeutralSettings.HelpCallRadius, Filter, Allies);
 
-	for (const FHitResult& Hit : HitResults)
+	for (AActor* Ally : Allies)
 	{
-		if (AActor* Ally = Hit.GetActor())
+		if (Group && Group->HasMember(Ally)) continue;
+
+		if (UAIBehaviorComponent* AllyBehavior = Ally->FindComponentByClass<UAIBehaviorComponent>())
 		{
-			if (Ally != OwnerEntity && Ally->IsA<ACombatEntity>())
-			{
-				if (UAIBehaviorComponent* AllyBehavior = Ally->FindComponentByClass<UAIBehaviorComponent>())
-				{
-					AllyBehavior->RespondToHelpCall(OwnerEntity);
-				}
-			}
+			AllyBehavior->JoinFight(TargetPlayer);
 		}
 	}
 }
 
 void UAIBehaviorComponent::RespondToHelpCall(AActor* Caller)
 {
-	if (!Caller || bIsInCombat) return;
+	if (!Caller || HotState->bIsInCombat) return;
 
 	// Join the fight
 	if (UAIBehaviorComponent* CallerBehavior = Caller->FindComponentByClass<UAIBehaviorComponent>())
 	{
-		TargetPlayer = CallerBehavior->TargetPlayer;
-		if (TargetPlayer)
-		{
-			bIsInCombat = true;
-			SetState(EAIState::Attacking);
-			OnEnteredCombat(TargetPlayer);
-		}
+		UAIGroup* CallerGroup = CallerBehavior->GetGroup();
+		JoinFight(CallerGroup && CallerGroup->IsAlerted() ? CallerGroup->GetSharedTarget() : CallerBehavior->TargetPlayer);
 	}
 }
 
+void UAIBehaviorComponent::JoinFight(ANinjaWizardCharacter* Target)
+{
+	if (!Target || HotState->bIsInCombat) return;
+
+	TargetPlayer = Target;
+	HotState->bIsInCombat = true;
+	SetStateWithReason(EAIState::Attacking, TEXT("JoinFight"));
+	OnEnteredCombat(TargetPlayer);
+}
+
 // ============================================
 // Area Guard Behavior Implementation
 // ============================================
@@ -455,13 +736,31 @@ void UAIBehaviorComponent::UpdateAreaGuardBehavior(float DeltaTime)
 {
 	if (!OwnerEntity) return;
 
-	ANinjaWizardCharacter* Player = FindNearestPlayer();
+	// Nobody in or near the territory, combat checks wait for the tracker to report a player
+	if (TerritoryId != INDEX_NONE && !TerritorySubsystem->IsOccupied(TerritoryId))
+	{
+		if (CurrentState == EAIState::Attacking || !IsInTerritory(OwnerEntity->GetActorLocation()))
+		{
+			if (CurrentState != EAIState::Returning)
+			{
+				ReturnToTerritory();
+			}
+		}
+		else if (CurrentState != EAIState::Guarding)
+		{
+			GuardTerritory();
+		}
+		return;
+	}
+
+	ANinjaWizardCharacter* Player = FindPlayerInAwareness();
 
 	// Check if player is in aggro range
 	if (Player && IsPlayerInAggroRange(Player))
 	{
-		// Check for cheesing (attacking from outside territory)
-		if (AreaGuardSettings.bEnableAntiCheese)
+		// Check for cheesing (attacking from outside territory), only for players lingering outside it
+		if (AreaGuardSettings.bEnableAntiCheese &&
+			(TerritoryId == INDEX_NONE || TerritorySubsystem->IsCheeseSuspect(TerritoryId, Player)))
 		{
 			DetectCheesing(Player);
 		}
@@ -475,8 +774,9 @@ void UAIBehaviorComponent::UpdateAreaGuardBehavior(float DeltaTime)
 		{
 			// Chase and attack
 			TargetPlayer = Player;
-			bIsInCombat = true;
-			SetState(EAIState::Attacking);
+			HotState->bIsInCombat = true;
+			SetStateWithReason(EAIState::Attacking, TEXT("IntruderInTerritory"));
+			PursueTarget(Player);
 		}
 	}
 	else
@@ -499,6 +799,40 @@ void UAIBehaviorComponent::SetTerritory(FVector Center, float Radius)
 {
 	AreaGuardSettings.TerritoryCenter = Center;
 	AreaGuardSettings.TerritoryRadius = Radius;
+
+	RefreshTerritory();
+}
+
+void UAIBehaviorComponent::RefreshTerritory()
+{
+	if (TerritorySubsystem && TerritoryId != INDEX_NONE)
+	{
+		TerritorySubsystem->UnregisterGuard(OwnerEntity, TerritoryId);
+	}
+	TerritoryId = INDEX_NONE;
+
+	if (!TerritorySubsystem || !OwnerEntity || BehaviorType != EAIBehaviorType::AreaGuard) return;
+
+	// Players this far from the center can be aggroed from the edge, or cheese it from outside
+	const float EngageRange = AreaGuardSettings.bEnableAntiCheese ?
+		FMath::Max(AreaGuardSettings.AggroRadius, AreaGuardSettings.AntiCheeseDetectionRadius) : AreaGuardSettings.AggroRadius;
+
+	TerritoryId = TerritorySubsystem->RegisterGuard(OwnerEntity, AreaGuardSettings.TerritoryCenter,
+		AreaGuardSettings.TerritoryRadius, AreaGuardSettings.TerritoryRadius + EngageRange,
+		FAITerritoryEventDelegate::CreateUObject(this, &UAIBehaviorComponent::HandleTerritoryEvent));
+}
+
+void UAIBehaviorComponent::HandleTerritoryEvent(EAITerritoryEvent Event, AActor* Player)
+{
+	// Leaving and cheese state are read from the tracker on the next update
+	if (Event != EAITerritoryEvent::Invaded) return;
+
+	if (TickManager)
+	{
+		TickManager->WakeAgent(this);
+	}
+
+	OnTerritoryInvaded(Cast<ANinjaWizardCharacter>(Player));
 }
 
 bool UAIBehaviorComponent::IsInTerritory(FVector Location) const
@@ -516,7 +850,7 @@ bool UAIBehaviorComponent::IsPlayerInAggroRange(ANinjaWizardCharacter* Player) c
 
 void UAIBehaviorComponent::GuardTerritory()
 {
-	SetState(EAIState::Guarding);
+	SetStateWithReason(EAIState::Guarding, TEXT("GuardTerritory"));
 
 	// Patrol around territory center
 	FVector PatrolPoint = GetRandomLocationInRadius(AreaGuardSettings.TerritoryCenter,
@@ -526,17 +860,17 @@ void UAIBehaviorComponent::GuardTerritory()
 
 void UAIBehaviorComponent::ReturnToTerritory()
 {
-	SetState(EAIState::Returning);
+	SetStateWithReason(EAIState::Returning, TEXT("ReturnToTerritory"));
 	MoveToLocation(AreaGuardSettings.TerritoryCenter);
 
 	// Stop combat when returning
-	bIsInCombat = false;
+	HotState->bIsInCombat = false;
 	TargetPlayer = nullptr;
 }
 
 void UAIBehaviorComponent::DetectCheesing(ANinjaWizardCharacter* Player)
 {
-	if (!Player || !OwnerEntity || bCheesingSeen) return;
+	if (!Player || !OwnerEntity || HotState->bCheesingSeen) return;
 
 	// Check if player is attacking but staying outside territory
 	float DistanceToCenter = FVector::Dist(Player->GetActorLocation(), AreaGuardSettings.TerritoryCenter);
@@ -549,7 +883,7 @@ void UAIBehaviorComponent::DetectCheesing(ANinjaWizardCharacter* Player)
 		// Check if owner is taking damage (being attacked)
 		if (OwnerEntity->GetHealthPercentage() < 0.95f)
 		{
-			bCheesingSeen = true;
+			HotState->bCheesingSeen = true;
 			SpawnPunishmentMobs(Player);
 			OnCheesingDetected(Player);
 		}
@@ -622,15 +956,15 @@ void UAIBehaviorComponent::UpdateAggressiveBehavior(float DeltaTime)
 		if (AggressiveSettings.bRespectSafeZones && IsPlayerInSafeZone(TargetPlayer))
 		{
 			StareAtPlayerInSafeZone(TargetPlayer);
-			bInSafeZone = true;
+			HotState->bInSafeZone = true;
 		}
 		else
 		{
 			// Chase the player
-			if (bInSafeZone)
+			if (HotState->bInSafeZone)
 			{
 				ResumeChaseWhenPlayerLeavesSafeZone(TargetPlayer);
-				bInSafeZone = false;
+				HotState->bInSafeZone = false;
 			}
 
 			ChasePlayerIndefinitely(TargetPlayer);
@@ -641,7 +975,7 @@ void UAIBehaviorComponent::UpdateAggressiveBehavior(float DeltaTime)
 		// Return to patrol/idle
 		if (CurrentState != EAIState::Patrolling)
 		{
-			SetState(EAIState::Patrolling);
+			SetStateWithReason(EAIState::Patrolling, TEXT("LostPlayer"));
 			StartWandering();
 		}
 	}
@@ -649,9 +983,9 @@ void UAIBehaviorComponent::UpdateAggressiveBehavior(float DeltaTime)
 
 void UAIBehaviorComponent::DetectPlayerInZone()
 {
-	ANinjaWizardCharacter* Player = FindNearestPlayer();
+	ANinjaWizardCharacter* Player = FindPlayerInAwareness();
 
-	if (Player && GetDistanceToPlayer(Player) <= AggressiveSettings.DetectionRadius)
+	if (Player)
 	{
 		if (!TargetPlayer)
 		{
@@ -663,8 +997,9 @@ void UAIBehaviorComponent::DetectPlayerInZone()
 	{
 		if (TargetPlayer && !AggressiveSettings.bChaseIndefinitely)
 		{
+			ANinjaWizardCharacter* LostPlayer = TargetPlayer;
 			TargetPlayer = nullptr;
-			OnLostPlayer(Player);
+			OnLostPlayer(LostPlayer);
 		}
 	}
 }
@@ -673,44 +1008,33 @@ void UAIBehaviorComponent::ChasePlayerIndefinitely(ANinjaWizardCharacter* Player
 {
 	if (!Player || !OwnerEntity) return;
 
-	SetState(EAIState::Chasing);
-	MoveToLocation(Player->GetActorLocation());
+	// Attack when in range, one transition per update
+	float Distance = GetDistanceToPlayer(Player);
+	if (Distance <= 200.0f) // Attack range
+	{
+		SetStateWithReason(EAIState::Attacking, TEXT("PlayerInAttackRange"));
+	}
+	else
+	{
+		SetStateWithReason(EAIState::Chasing, TEXT("ChasePlayer"));
+	}
+
+	PursueTarget(Player);
 
 	// Increase movement speed for boss chases
 	if (UCharacterMovementComponent* Movement = OwnerEntity->GetCharacterMovement())
 	{
 		Movement->MaxWalkSpeed = AggressiveSettings.ChaseSpeed;
 	}
-
-	// Attack when in range
-	float Distance = GetDistanceToPlayer(Player);
-	if (Distance <= 200.0f) // Attack range
-	{
-		SetState(EAIState::Attacking);
-	}
 }
 
 bool UAIBehaviorComponent::IsPlayerInSafeZone(ANinjaWizardCharacter* Player) const
 {
 	if (!Player || !GetWorld()) return false;
 
-	// Find all SafeZoneVolumes in the world
-	TArray<AActor*> SafeZones;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ASafeZoneVolume::StaticClass(), SafeZones);
-
-	// Check if player is in any safe zone
-	for (AActor* Zone : SafeZones)
-	{
-		if (ASafeZoneVolume* SafeZone = Cast<ASafeZoneVolume>(Zone))
-		{
-			if (SafeZone->IsActorInSafeZone(Player))
-			{
-				return true;
-			}
-		}
-	}
-
-	return false;
+	// Zones report their occupants through overlap events, so this is a single lookup
+	const USafeZoneSubsystem* SafeZones = GetWorld()->GetSubsystem<USafeZoneSubsystem>();
+	return SafeZones && SafeZones->IsActorInAnySafeZone(Player);
 }
 
 void UAIBehaviorComponent::StareAtPlayerInSafeZone(ANinjaWizardCharacter* Player)
@@ -718,7 +1042,7 @@ void UAIBehaviorComponent::StareAtPlayerInSafeZone(ANinjaWizardCharacter* Player
 	if (!Player || !OwnerEntity) return;
 
 	StopMovement();
-	SetState(EAIState::Idle);
+	SetStateWithReason(EAIState::Idle, TEXT("PlayerInSafeZone"));
 
 	// Rotate to face player menacingly
 	RotateTowards(Player, 1.0f);
@@ -734,7 +1058,7 @@ void UAIBehaviorComponent::ResumeChaseWhenPlayerLeavesSafeZone(ANinjaWizardChara
 	if (!Player) return;
 
 	OnDetectedPlayer(Player);
-	SetState(EAIState::Chasing);
+	SetStateWithReason(EAIState::Chasing, TEXT("PlayerLeftSafeZone"));
 }
 
 // ============================================
@@ -743,13 +1067,91 @@ void UAIBehaviorComponent::ResumeChaseWhenPlayerLeavesSafeZone(ANinjaWizardChara
 
 void UAIBehaviorComponent::RegisterWithGroup(AActor* Leader)
 {
-	GroupLeader = Leader;
+	if (!Leader) return;
+
+	// Join the leader's group, creating it for the leader if needed
+	UAIBehaviorComponent* LeaderBehavior = Leader->FindComponentByClass<UAIBehaviorComponent>();
+	if (LeaderBehavior && LeaderBehavior != this)
+	{
+		if (!LeaderBehavior->GetGroup())
+		{
+			LeaderBehavior->JoinGroup(NewObject<UAIGroup>(LeaderBehavior));
+		}
+		JoinGroup(LeaderBehavior->GetGroup());
+	}
+	else
+	{
+		// Leader without behavior, e.g. a player-placed actor
+		UAIGroup* NewGroup = NewObject<UAIGroup>(this);
+		NewGroup->SetLeader(Leader);
+		JoinGroup(NewGroup);
+	}
 }
 
 void UAIBehaviorComponent::LeaveGroup()
 {
-	GroupLeader = nullptr;
-	GroupMembers.Empty();
+	if (FlockingSubsystem)
+	{
+		FlockingSubsystem->LeaveFlock(OwnerEntity);
+	}
+
+	if (Group)
+	{
+		UAIGroup* OldGroup = Group;
+		Group = nullptr;
+		OldGroup->RemoveMember(this);
+	}
+}
+
+void UAIBehaviorComponent::JoinGroup(UAIGroup* NewGroup)
+{
+	if (NewGroup == Group) return;
+
+	LeaveGroup();
+
+	Group = NewGroup;
+	if (Group)
+	{
+		Group->AddMember(this);
+	}
+
+	JoinLeaderFlock();
+}
+
+TArray<AActor*> UAIBehaviorComponent::GetGroupMembers() const
+{
+	return Group ? Group->GetMemberActors() : TArray<AActor*>();
+}
+
+AActor* UAIBehaviorComponent::GetGroupLeader() const
+{
+	return Group ? Group->GetLeader() : nullptr;
+}
+
+void UAIBehaviorComponent::OnGroupLeaderChanged()
+{
+	JoinLeaderFlock();
+}
+
+void UAIBehaviorComponent::JoinLeaderFlock()
+{
+	if (!FlockingSubsystem || !OwnerEntity) return;
+
+	AActor* GroupLeader = GetGroupLeader();
+	if (!GroupLeader || GroupLeader == OwnerEntity || NeutralSettings.GroupType == EGroupBehavior::Solo)
+	{
+		FlockingSubsystem->LeaveFlock(OwnerEntity);
+		return;
+	}
+
+	// Hand movement over to flock steering
+	StopMovement();
+	FlockingSubsystem->JoinFlock(GroupLeader, OwnerEntity, NeutralSettings.GroupCohesionRadius);
+}
+
+bool UAIBehaviorComponent::IsFlockingMember() const
+{
+	return FlockingSubsystem && OwnerEntity && FlockingSubsystem->IsFlocking(OwnerEntity);
 }
 
 // ============================================
@@ -770,8 +1172,144 @@ float UAIBehaviorComponent::GetDistanceToPlayer(ANinjaWizardCharacter* Player) c
 	return FVector::Dist(OwnerEntity->GetActorLocation(), Player->GetActorLocation());
 }
 
+float UAIBehaviorComponent::GetAwarenessRadius() const
+{
+	switch (BehaviorType)
+	{
+		case EAIBehaviorType::Passive:
+			return PassiveSettings.bCanFlee ? PassiveSettings.FleeDistance : 0.0f;
+		case EAIBehaviorType::Chasing:
+			return ChasingSettings.DetectionRadius;
+		case EAIBehaviorType::AreaGuard:
+			return AreaGuardSettings.AggroRadius;
+		case EAIBehaviorType::Aggressive:
+			return AggressiveSettings.DetectionRadius;
+		default:
+			// Neutral mobs only react to being attacked
+			return 0.0f;
+	}
+}
+
+void UAIBehaviorComponent::RefreshProximityRings()
+{
+	PlayersInAwareness.Empty();
+	bUsesProximityRings = false;
+
+	if (!ProximitySubsystem || !OwnerEntity) return;
+
+	ProximitySubsystem->UnsubscribeRing(OwnerEntity, AwarenessRingName);
+
+	const float Radius = GetAwarenessRadius();
+	if (Radius > 0.0f)
+	{
+		ProximitySubsystem->SubscribeRing(OwnerEntity, AwarenessRingName, Radius,
+			FAIProximityRingDelegate::CreateUObject(this, &UAIBehaviorComponent::HandleAwarenessRing));
+	}
+
+	bUsesProximityRings = true;
+}
+
+void UAIBehaviorComponent::HandleAwarenessRing(FName RingName, AActor* Player, bool bInside)
+{
+	ANinjaWizardCharacter* PlayerCharacter = Cast<ANinjaWizardCharacter>(Player);
+
+	if (bInside && PlayerCharacter)
+	{
+		PlayersInAwareness.AddUnique(PlayerCharacter);
+	}
+	else
+	{
+		PlayersInAwareness.Remove(PlayerCharacter);
+		PlayersInAwareness.Remove(nullptr);
+	}
+}
+
+ANinjaWizardCharacter* UAIBehaviorComponent::FindPlayerInAwareness() const
+{
+	if (!bUsesProximityRings)
+	{
+		ANinjaWizardCharacter* Player = FindNearestPlayer();
+		return Player && GetDistanceToPlayer(Player) <= GetAwarenessRadius() ? Player : nullptr;
+	}
+
+	ANinjaWizardCharacter* Nearest = nullptr;
+	float NearestDistance = TNumericLimits<float>::Max();
+	for (ANinjaWizardCharacter* Player : PlayersInAwareness)
+	{
+		const float Distance = GetDistanceToPlayer(Player);
+		if (IsValid(Player) && Distance < NearestDistance)
+		{
+			Nearest = Player;
+			NearestDistance = Distance;
+		}
+	}
+
+	return Nearest;
+}
+
+void UAIBehaviorComponent::CatchUpDormantTime(float ElapsedTime)
+{
+	if (ElapsedTime <= 0.0f) return;
+
+	HotState->TimeSinceLastAction += ElapsedTime;
+	HotState->TimeSinceLastMeal += ElapsedTime;
+	HotState->PendingDeltaTime = 0.0f;
+
+	// Wander timers keep their phase instead of firing once per missed interval
+	const float WanderInterval = BehaviorType == EAIBehaviorType::Passive ? PassiveSettings.WanderInterval :
+		BehaviorType == EAIBehaviorType::Chasing ? 3.0f : 5.0f;
+	HotState->TimeSinceLastWander = FMath::Fmod(HotState->TimeSinceLastWander + ElapsedTime, FMath::Max(WanderInterval, KINDA_SMALL_NUMBER));
+
+	// Stamina regenerates at the same rate as while awake
+	HotState->CurrentStamina = FMath::Min(HotState->CurrentStamina + ElapsedTime * 5.0f, ChasingSettings.MaxStamina);
+	if (HotState->CurrentStamina >= ChasingSettings.MaxStamina * 0.5f)
+	{
+		HotState->bIsExhausted = false;
+	}
+
+	// A meal in progress has long finished, and movement stopped when it fell asleep
+	if (CurrentState == EAIState::Eating)
+	{
+		HotState->TimeSinceLastEat += ElapsedTime;
+	}
+	else if (CurrentState == EAIState::Wandering || CurrentState == EAIState::Patrolling)
+	{
+		ReleaseVegetation();
+		SetStateWithReason(EAIState::Idle, TEXT("DormantCatchUp"));
+	}
+}
+
+bool UAIBehaviorComponent::UpdateFleeTarget(const AActor* Threat, float FleeDistance)
+{
+	const FVector Location = OwnerEntity->GetActorLocation();
+
+	// Keep running to the current target while it is still safer than here
+	if (CurrentState == EAIState::Fleeing && ThreatMapSubsystem &&
+		FVector::DistSquared2D(Location, FleeTarget) > FMath::Square(FleeTargetReachedDistance) &&
+		ThreatMapSubsystem->GetThreatAt(FleeTarget) < ThreatMapSubsystem->GetThreatAt(Location))
+	{
+		return false;
+	}
+
+	if (!ThreatMapSubsystem || !ThreatMapSubsystem->FindFleeLocation(Location, Threat->GetActorLocation(), FleeDistance, FleeTarget))
+	{
+		// Straight away from the threat
+		const FVector FleeDirection = (Location - Threat->GetActorLocation()).GetSafeNormal();
+		FleeTarget = Location + (FleeDirection * FleeDistance);
+	}
+
+	return true;
+}
+
 FVector UAIBehaviorComponent::GetRandomLocationInRadius(FVector Origin, float Radius) const
 {
+	// Pooled points are already validated against the navmesh
+	FVector PooledPoint;
+	if (WanderPointSubsystem && WanderPointSubsystem->GetRandomPoint(Origin, Radius, PooledPoint))
+	{
+		return PooledPoint;
+	}
+
 	FVector RandomDirection = FMath::VRand();
 	RandomDirection.Z = 0; // Keep on ground level
 	RandomDirection.Normalize();
@@ -784,13 +1322,59 @@ void UAIBehaviorComponent::MoveToLocation(FVector Location)
 {
 	if (!AIController) return;
 
+	if (NavigationSubsystem)
+	{
+		NavigationSubsystem->RequestMove(AIController, Location, 50.0f);
+		return;
+	}
+
 	AIController->MoveToLocation(Location, 50.0f);
 }
 
+void UAIBehaviorComponent::PursueTarget(AActor* Target)
+{
+	if (!Target || !OwnerEntity) return;
+
+	if (FlowFieldSubsystem)
+	{
+		FlowFieldSubsystem->SetPursuitTarget(OwnerEntity, Target);
+
+		// The field feeds movement input every tick, a path would fight it
+		if (FlowFieldSubsystem->IsSteering(OwnerEntity))
+		{
+			if (!bSteeredByFlowField)
+			{
+				StopMovement();
+				bSteeredByFlowField = true;
+			}
+			return;
+		}
+	}
+
+	bSteeredByFlowField = false;
+	MoveToLocation(Target->GetActorLocation());
+}
+
+void UAIBehaviorComponent::StopPursuit()
+{
+	if (FlowFieldSubsystem && OwnerEntity)
+	{
+		FlowFieldSubsystem->ClearPursuit(OwnerEntity);
+	}
+	bSteeredByFlowField = false;
+}
+
 void UAIBehaviorComponent::StopMovement()
 {
 	if (!AIController) return;
 
+	// Also drops a goal still waiting for its repath interval
+	if (NavigationSubsystem)
+	{
+		NavigationSubsystem->CancelMove(AIController);
+		return;
+	}
+
 	AIController->StopMovement();
 }
 
@@ -822,7 +1406,23 @@ void UAIBehaviorComponent::RotateTowards(AActor* Target, float DeltaTime)
 
 AActor* UAIBehaviorComponent::FindNearestVegetation() const
 {
-	// This would search for actors with vegetation tags
-	// Implementation depends on how you tag vegetation in your world
-	return nullptr;
+	UVegetationSubsystem* VegetationSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UVegetationSubsystem>() : nullptr;
+	if (!VegetationSubsystem || !OwnerEntity) return nullptr;
+
+	TArray<AActor*> Found;
+	VegetationSubsystem->FindNearestVegetation(OwnerEntity->GetActorLocation(), PassiveSettings.PreferredVegetationTags,
+		1, PassiveSettings.VegetationSearchRadius, true, Found);
+
+	return Found.Num() > 0 ? Found[0] : nullptr;
+}
+
+void UAIBehaviorComponent::ReleaseVegetation()
+{
+	if (!CurrentVegetation) return;
+
+	if (UVegetationSubsystem* VegetationSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UVegetationSubsystem>() : nullptr)
+	{
+		VegetationSubsystem->ReleaseVegetation(CurrentVegetation, this);
+	}
+	CurrentVegetation = nullptr;
 }
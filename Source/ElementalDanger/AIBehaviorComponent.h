@@ -10,6 +10,30 @@
 class ACombatEntity;
 class ANinjaWizardCharacter;
 class AAIController;
+class UAITickManagerSubsystem;
+class UAIProximitySubsystem;
+class UAIFlockingSubsystem;
+class UAIGroup;
+class UAIMassSubsystem;
+class UAINavigationSubsystem;
+class UAIFlowFieldSubsystem;
+class UAIWanderPointSubsystem;
+class UAIThreatMapSubsystem;
+class UAITerritorySubsystem;
+enum class EAITerritoryEvent : uint8;
+
+/**
+ * One entry of an agent's state-transition journal
+ */
+struct FAIStateTransition
+{
+	double Time = 0.0;
+	EAIState OldState = EAIState::Idle;
+	EAIState NewState = EAIState::Idle;
+
+	// String literal naming what caused the transition, see SetStateWithReason
+	const TCHAR* Reason = TEXT("");
+};
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class ELEMENTALDANGER_API UAIBehaviorComponent : public UActorComponent
@@ -21,6 +45,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -51,6 +76,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Behavior|Aggressive")
 	FAggressiveBehaviorSettings AggressiveSettings;
 
+	// Passive and Chasing mobs far from players are simulated as Mass entities instead of actors
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Behavior|Mass")
+	bool bAllowMassRepresentation = false;
+
 	// ============================================
 	// State Management
 	// ============================================
@@ -61,9 +90,27 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AI Behavior")
 	void SetState(EAIState NewState);
 
+	// Does nothing when already in NewState, otherwise journals the transition and fires OnStateChanged.
+	// The journal keeps the Reason pointer, so only string literals are accepted.
+	template <SIZE_T N>
+	void SetStateWithReason(EAIState NewState, const TCHAR (&Reason)[N])
+	{
+		ApplyStateTransition(NewState, Reason);
+	}
+
+	// Logs the journaled transitions, oldest first (ai.DumpStateJournal)
+	void DumpStateJournal() const;
+
 	UFUNCTION(BlueprintCallable, Category = "AI Behavior")
 	EAIState GetCurrentState() const { return CurrentState; }
 
+	UFUNCTION(BlueprintCallable, Category = "AI Behavior")
+	EAILODTier GetLODTier() const { return HotState->LODTier; }
+
+	// Seconds since the last behavior decision (0 when ticking every frame)
+	UFUNCTION(BlueprintCallable, Category = "AI Behavior")
+	float GetDecisionStaleness() const { return HotState->PendingDeltaTime; }
+
 	// ============================================
 	// Passive Behavior
 	// ============================================
@@ -179,7 +226,31 @@ public:
 	void LeaveGroup();
 
 	UFUNCTION(BlueprintCallable, Category = "AI Behavior|Group")
-	TArray<AActor*> GetGroupMembers() const { return GroupMembers; }
+	TArray<AActor*> GetGroupMembers() const;
+
+	UFUNCTION(BlueprintCallable, Category = "AI Behavior|Group")
+	UAIGroup* GetGroup() const { return Group; }
+
+	UFUNCTION(BlueprintCallable, Category = "AI Behavior|Group")
+	AActor* GetGroupLeader() const;
+
+	// Switches to another group, leaving the current one
+	UFUNCTION(BlueprintCallable, Category = "AI Behavior|Group")
+	void JoinGroup(UAIGroup* NewGroup);
+
+	// Enters combat against Target unless already fighting
+	UFUNCTION(BlueprintCallable, Category = "AI Behavior|Group")
+	void JoinFight(ANinjaWizardCharacter* Target);
+
+	// Called by the group when leadership changes
+	void OnGroupLeaderChanged();
+
+	// ============================================
+	// Dormancy
+	// ============================================
+
+	// Advances wander, meal and stamina state by time spent dormant
+	void CatchUpDormantTime(float ElapsedTime);
 
 	// ============================================
 	// Utility Functions
@@ -200,6 +271,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AI Behavior")
 	void StopMovement();
 
+	// Re-subscribes the awareness ring after BehaviorType or its radius setting changed
+	UFUNCTION(BlueprintCallable, Category = "AI Behavior")
+	void RefreshProximityRings();
+
+	// Radius within which the current behavior type reacts to players (0 = never)
+	UFUNCTION(BlueprintCallable, Category = "AI Behavior")
+	float GetAwarenessRadius() const;
+
 	// ============================================
 	// Events
 	// ============================================
@@ -229,6 +308,9 @@ public:
 	void OnCaughtByPlayer(ANinjaWizardCharacter* Player);
 
 protected:
+	// Backs SetStateWithReason, Reason must outlive the journal
+	void ApplyStateTransition(EAIState NewState, const TCHAR* Reason);
+
 	// References
 	UPROPERTY()
 	ACombatEntity* OwnerEntity;
@@ -239,28 +321,101 @@ protected:
 	UPROPERTY()
 	ANinjaWizardCharacter* TargetPlayer;
 
-	// Group management
+	// Shared with every other member of the pack
 	UPROPERTY()
-	TArray<AActor*> GroupMembers;
+	UAIGroup* Group;
 
-	UPROPERTY()
-	AActor* GroupLeader;
+	// Ring buffer of the last StateJournalSize transitions
+	static constexpr int32 StateJournalSize = 32;
+	TStaticArray<FAIStateTransition, StateJournalSize> StateJournal;
+	int32 StateJournalHead = 0;
+	int32 StateJournalCount = 0;
+
+	// SetState calls that requested the current state
+	int32 NumRedundantStateChanges = 0;
 
 	// State tracking
 	FVector SpawnLocation;
 	FVector WanderTarget;
+	FVector FleeTarget;
+
+	// Vegetation this mob has reserved and is walking to or eating
+	UPROPERTY()
 	AActor* CurrentVegetation;
 
-	float CurrentStamina;
-	float TimeSinceLastAction;
-	float TimeSinceLastWander;
-	float TimeSinceLastEat;
+	// Hot state lives in the tick manager's per-type arrays while batched,
+	// otherwise HotState points at LocalHotState
+	FAIBehaviorHotState LocalHotState;
+	FAIBehaviorHotState* HotState;
+
+	// Batched ticking
+	UPROPERTY()
+	UAITickManagerSubsystem* TickManager;
+
+	int32 TickManagerIndex = INDEX_NONE;
+	EAIBehaviorType ManagedBehaviorType = EAIBehaviorType::Passive;
+
+	friend class UAITickManagerSubsystem;
+
+	// Player proximity events, replaces polling FindNearestPlayer while subscribed
+	UPROPERTY()
+	UAIProximitySubsystem* ProximitySubsystem;
+
+	UPROPERTY()
+	TArray<ANinjaWizardCharacter*> PlayersInAwareness;
+
+	bool bUsesProximityRings = false;
+
+	void HandleAwarenessRing(FName RingName, AActor* Player, bool bInside);
+
+	// Nearest player within GetAwarenessRadius, from ring events when subscribed
+	ANinjaWizardCharacter* FindPlayerInAwareness() const;
+
+	// Group members are steered by the flocking subsystem instead of pathing to the leader
+	UPROPERTY()
+	UAIFlockingSubsystem* FlockingSubsystem;
+
+	void JoinLeaderFlock();
+	bool IsFlockingMember() const;
+
+	// Moves go through the request layer, which merges and rate-limits repaths
+	UPROPERTY()
+	UAINavigationSubsystem* NavigationSubsystem;
+
+	// Large groups chasing one target share its flow field instead of pathing
+	UPROPERTY()
+	UAIFlowFieldSubsystem* FlowFieldSubsystem;
+
+	bool bSteeredByFlowField = false;
+
+	// Wander and patrol targets are picked from pooled reachable points
+	UPROPERTY()
+	UAIWanderPointSubsystem* WanderPointSubsystem;
+
+	// Flee targets are picked from the shared threat grid and kept while they stay safer
+	UPROPERTY()
+	UAIThreatMapSubsystem* ThreatMapSubsystem;
+
+	// True when a new flee target was chosen and needs a move
+	bool UpdateFleeTarget(const AActor* Threat, float FleeDistance);
+
+	// Area guards share their territory's occupancy instead of polling player distances
+	UPROPERTY()
+	UAITerritorySubsystem* TerritorySubsystem;
+
+	int32 TerritoryId = INDEX_NONE;
+
+	void RefreshTerritory();
+	void HandleTerritoryEvent(EAITerritoryEvent Event, AActor* Player);
+
+	void PursueTarget(AActor* Target);
+	void StopPursuit();
+
+	// Swaps this actor for a Mass entity when no player is near
+	UPROPERTY()
+	UAIMassSubsystem* MassSubsystem;
 
-	bool bIsInCombat;
-	bool bIsFleeing;
-	bool bIsExhausted;
-	bool bCheesingSeen;
-	bool bInSafeZone;
+	friend class UAIMassSubsystem;
 
 	// Timers
 	FTimerHandle WanderTimerHandle;
@@ -279,4 +434,5 @@ protected:
 	bool CanSeeActor(AActor* Target) const;
 	void RotateTowards(AActor* Target, float DeltaTime);
 	AActor* FindNearestVegetation() const;
+	void ReleaseVegetation();
 };
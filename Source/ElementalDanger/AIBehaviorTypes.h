@@ -93,6 +93,31 @@ enum class EBossAttackPattern : uint8
 	PhasedAttack    UMETA(DisplayName = "Multi-Phase Attack")
 };
 
+/**
+ * Phase of the melee swing a combat AI is performing
+ */
+UENUM(BlueprintType)
+enum class EAIAttackPhase : uint8
+{
+	Idle            UMETA(DisplayName = "Idle"),
+	Windup          UMETA(DisplayName = "Windup"),
+	Active          UMETA(DisplayName = "Active - Hit Lands"),
+	Recovery        UMETA(DisplayName = "Recovery"),
+	ComboGap        UMETA(DisplayName = "Combo Gap")
+};
+
+/**
+ * Significance tiers for AI updates, nearest player distance decides the tier
+ */
+UENUM(BlueprintType)
+enum class EAILODTier : uint8
+{
+	Full            UMETA(DisplayName = "Full - Every Frame"),
+	Reduced         UMETA(DisplayName = "Reduced - Lower Update Rate"),
+	MovementOnly    UMETA(DisplayName = "Movement Only - No Decisions"),
+	Frozen          UMETA(DisplayName = "Frozen - No Updates")
+};
+
 // ============================================
 // AI Behavior Structs
 // ============================================
@@ -125,6 +150,9 @@ struct FPassiveBehaviorSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Passive")
 	TArray<FName> PreferredVegetationTags;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Passive")
+	float VegetationSearchRadius = 3000.0f;
 };
 
 /**
@@ -185,6 +213,14 @@ struct FNeutralBehaviorSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Neutral")
 	float HelpCallRadius = 500.0f;
+
+	// Seconds a group alert lasts unless a member is attacked or calls for help again
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Neutral")
+	float GroupAlertDuration = 30.0f;
+
+	// The alert ends when the shared target gets this far from the group leader
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Neutral")
+	float GroupAlertLeashRadius = 3000.0f;
 };
 
 /**
@@ -290,6 +326,9 @@ struct FAIAttackData
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
 	TSubclassOf<AActor> ProjectileClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attack")
+	float ProjectileSpeed = 1000.0f;
 };
 
 /**
@@ -345,3 +384,65 @@ struct FBossPhaseData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Boss Phase")
 	TSubclassOf<AActor> MinionClass;
 };
+
+/**
+ * Per-agent state touched on every behavior update.
+ * Stored contiguously per behavior type by UAITickManagerSubsystem while batched ticking is active.
+ */
+USTRUCT()
+struct FAIBehaviorHotState
+{
+	GENERATED_BODY()
+
+	float CurrentStamina = 100.0f;
+	float TimeSinceLastAction = 0.0f;
+	float TimeSinceLastWander = 0.0f;
+	float TimeSinceLastEat = 0.0f;
+	float TimeSinceLastMeal = 0.0f;
+
+	bool bIsInCombat = false;
+	bool bIsFleeing = false;
+	bool bIsExhausted = false;
+	bool bCheesingSeen = false;
+	bool bInSafeZone = false;
+
+	// LOD: time accumulated since the last behavior update
+	EAILODTier LODTier = EAILODTier::Full;
+	float PendingDeltaTime = 0.0f;
+
+	// Random head start towards the first update after a tier change, never handed to the update as time
+	float StaggerOffset = 0.0f;
+};
+
+/**
+ * What an agent is allowed to do while in a given LOD tier
+ */
+USTRUCT(BlueprintType)
+struct FAILODTierSettings
+{
+	GENERATED_BODY()
+
+	// Agents farther than this from every player drop to the next tier
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+	float MaxDistance = 2500.0f;
+
+	// Seconds between updates (0 = every frame)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+	float UpdateInterval = 0.0f;
+
+	// Run the behavior state machine and combat AI
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+	bool bRunBehavior = true;
+
+	// Evaluate dodge/block/retreat decisions
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+	bool bRunCombatDecisions = true;
+
+	// Allow line of sight traces
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+	bool bAllowTraces = true;
+
+	// Keep CharacterMovement ticking
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI LOD")
+	bool bAllowMovement = true;
+};
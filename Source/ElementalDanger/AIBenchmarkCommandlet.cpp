@@ -0,0 +1,370 @@
+// AI Benchmark Commandlet Implementation
+
+#include "AIBenchmarkCommandlet.h"
+#include "AIBehaviorComponent.h"
+#include "CombatAIComponent.h"
+#include "AITickManagerSubsystem.h"
+#include "AINavigationSubsystem.h"
+#include "AILineOfSightSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "GameMapsSettings.h"
+#include "GameFramework/PlayerController.h"
+#include "NavigationSystem.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/App.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+UAIBenchmarkCommandlet::UAIBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+
+	BehaviorTypeClasses =
+	{
+		TSoftClassPtr<APawn>(FSoftObjectPath(TEXT("/Game/BP_PassiveEnemy.BP_PassiveEnemy_C"))),
+		TSoftClassPtr<APawn>(FSoftObjectPath(TEXT("/Game/BP_ChasingEnemy.BP_ChasingEnemy_C"))),
+		TSoftClassPtr<APawn>(FSoftObjectPath(TEXT("/Game/BP_NeutralEnemy.BP_NeutralEnemy_C"))),
+		TSoftClassPtr<APawn>(FSoftObjectPath(TEXT("/Game/BP_AreaGuardEnemy.BP_AreaGuardEnemy_C"))),
+		TSoftClassPtr<APawn>(FSoftObjectPath(TEXT("/Game/BP_BossEnemy.BP_BossEnemy_C")))
+	};
+	CombatRoleClass = TSoftClassPtr<APawn>(FSoftObjectPath(TEXT("/Game/BP_EnemyBase.BP_EnemyBase_C")));
+	PlayerClass = TSoftClassPtr<APawn>(FSoftObjectPath(TEXT("/Game/BP_MainChar.BP_MainChar_C")));
+}
+
+// ============================================
+// Run
+// ============================================
+
+int32 UAIBenchmarkCommandlet::Main(const FString& Params)
+{
+	FString MapName = TEXT("/Game/TestMap");
+	int32 NumFrames = 600;
+	int32 NumWarmupFrames = 60;
+	float DeltaTime = 1.0f / 30.0f;
+	int32 Seed = 1;
+	float SpawnExtent = 8000.0f;
+	float PathRadius = 3000.0f;
+	float PathSpeed = 600.0f;
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks/AIBenchmark.json");
+
+	FParse::Value(*Params, TEXT("Map="), MapName);
+	FParse::Value(*Params, TEXT("Frames="), NumFrames);
+	FParse::Value(*Params, TEXT("WarmupFrames="), NumWarmupFrames);
+	FParse::Value(*Params, TEXT("DeltaTime="), DeltaTime);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+	FParse::Value(*Params, TEXT("SpawnExtent="), SpawnExtent);
+	FParse::Value(*Params, TEXT("PathRadius="), PathRadius);
+	FParse::Value(*Params, TEXT("PathSpeed="), PathSpeed);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	if (NumFrames <= 0 || DeltaTime <= 0.0f)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AIBenchmark: Frames and DeltaTime must be positive"));
+		return 1;
+	}
+
+	// -Passive=100 -Warrior=10 etc, named after the enum entries
+	const UEnum* BehaviorTypeEnum = StaticEnum<EAIBehaviorType>();
+	const UEnum* CombatRoleEnum = StaticEnum<EAICombatRole>();
+
+	TArray<int32> BehaviorTypeCounts;
+	BehaviorTypeCounts.SetNumZeroed(BehaviorTypeClasses.Num());
+	for (int32 TypeIndex = 0; TypeIndex < BehaviorTypeCounts.Num(); ++TypeIndex)
+	{
+		FParse::Value(*Params, *(BehaviorTypeEnum->GetNameStringByIndex(TypeIndex) + TEXT("=")), BehaviorTypeCounts[TypeIndex]);
+	}
+
+	const int32 NumCombatRoles = CombatRoleEnum->NumEnums() - 1;
+	TArray<int32> CombatRoleCounts;
+	CombatRoleCounts.SetNumZeroed(NumCombatRoles);
+	for (int32 RoleIndex = 0; RoleIndex < NumCombatRoles; ++RoleIndex)
+	{
+		FParse::Value(*Params, *(CombatRoleEnum->GetNameStringByIndex(RoleIndex) + TEXT("=")), CombatRoleCounts[RoleIndex]);
+	}
+
+	UWorld* World = LoadWorld(MapName);
+	if (!World)
+	{
+		UE_LOG(LogTemp, Error, TEXT("AIBenchmark: Could not load map %s"), *MapName);
+		return 1;
+	}
+
+	// Spawn positions and the AI's own random choices repeat between runs
+	FRandomStream Random(Seed);
+	FMath::RandInit(Seed);
+	FMath::SRandInit(Seed);
+
+	const FVector Center = FVector::ZeroVector;
+
+	// Player walking the scripted path, possessed so AI sees it through the player controller
+	APawn* PlayerPawn = nullptr;
+	if (UClass* LoadedPlayerClass = PlayerClass.LoadSynchronous())
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		PlayerPawn = World->SpawnActor<APawn>(LoadedPlayerClass, Center + FVector(PathRadius, 0.0f, 0.0f), FRotator::ZeroRotator, SpawnParams);
+
+		if (APlayerController* PlayerController = World->SpawnActor<APlayerController>())
+		{
+			PlayerController->Possess(PlayerPawn);
+		}
+	}
+
+	int32 NumAgents = 0;
+	for (int32 TypeIndex = 0; TypeIndex < BehaviorTypeCounts.Num(); ++TypeIndex)
+	{
+		UClass* AgentClass = BehaviorTypeCounts[TypeIndex] > 0 ? BehaviorTypeClasses[TypeIndex].LoadSynchronous() : nullptr;
+		if (!AgentClass) continue;
+
+		for (int32 Index = 0; Index < BehaviorTypeCounts[TypeIndex]; ++Index)
+		{
+			APawn* Agent = SpawnAgent(World, AgentClass, Center, SpawnExtent, Random);
+			UAIBehaviorComponent* Behavior = Agent ? Agent->FindComponentByClass<UAIBehaviorComponent>() : nullptr;
+			if (!Behavior) continue;
+
+			Behavior->SetBehaviorType(static_cast<EAIBehaviorType>(TypeIndex));
+			NumAgents++;
+		}
+	}
+
+	UClass* LoadedRoleClass = CombatRoleClass.LoadSynchronous();
+	for (int32 RoleIndex = 0; RoleIndex < NumCombatRoles && LoadedRoleClass; ++RoleIndex)
+	{
+		for (int32 Index = 0; Index < CombatRoleCounts[RoleIndex]; ++Index)
+		{
+			APawn* Agent = SpawnAgent(World, LoadedRoleClass, Center, SpawnExtent, Random);
+			UCombatAIComponent* CombatAI = Agent ? Agent->FindComponentByClass<UCombatAIComponent>() : nullptr;
+			if (!CombatAI) continue;
+
+			CombatAI->CombatRole = static_cast<EAICombatRole>(RoleIndex);
+			NumAgents++;
+		}
+	}
+
+	UAITickManagerSubsystem* TickManager = World->GetSubsystem<UAITickManagerSubsystem>();
+	UAINavigationSubsystem* Navigation = World->GetSubsystem<UAINavigationSubsystem>();
+	UAILineOfSightSubsystem* LineOfSight = World->GetSubsystem<UAILineOfSightSubsystem>();
+
+	// Everything spawned while measuring, projectiles, punishment mobs and so on
+	int32 NumSpawns = 0;
+	bool bMeasuring = false;
+	const FDelegateHandle SpawnHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateLambda(
+		[&NumSpawns, &bMeasuring](AActor*) { if (bMeasuring) NumSpawns++; }));
+
+	double SimulatedTime = 0.0;
+	auto StepFrame = [&]()
+	{
+		SimulatedTime += DeltaTime;
+
+		if (PlayerPawn)
+		{
+			const float Angle = PathRadius > 0.0f ? PathSpeed * SimulatedTime / PathRadius : 0.0f;
+			const FVector PathLocation = Center + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * PathRadius;
+			PlayerPawn->SetActorLocation(FVector(PathLocation.X, PathLocation.Y, PlayerPawn->GetActorLocation().Z));
+		}
+
+		FApp::SetDeltaTime(DeltaTime);
+		FApp::SetCurrentTime(FApp::GetCurrentTime() + DeltaTime);
+		GFrameCounter++;
+
+		World->Tick(LEVELTICK_All, DeltaTime);
+	};
+
+	for (int32 Frame = 0; Frame < NumWarmupFrames; ++Frame)
+	{
+		StepFrame();
+	}
+
+	// Counters are read as deltas over the measured frames
+	const int32 StartRequests = Navigation ? Navigation->GetNavigationStats().TotalRequests : 0;
+	const int32 StartPathfinds = Navigation ? Navigation->GetNavigationStats().TotalPathfinds : 0;
+	const int32 StartLineOfSightTraces = LineOfSight ? LineOfSight->GetNumTracesDispatched() : 0;
+
+	if (TickManager)
+	{
+		TickManager->SetCollectBehaviorTimings(true);
+	}
+
+	TArray<double> FrameTimesMs;
+	FrameTimesMs.Reserve(NumFrames);
+	bMeasuring = true;
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const double FrameStartTime = FPlatformTime::Seconds();
+		StepFrame();
+		FrameTimesMs.Add((FPlatformTime::Seconds() - FrameStartTime) * 1000.0);
+	}
+
+	bMeasuring = false;
+	World->RemoveOnActorSpawnedHandler(SpawnHandle);
+
+	// ============================================
+	// Report
+	// ============================================
+
+	TArray<double> SortedFrameTimes = FrameTimesMs;
+	SortedFrameTimes.Sort();
+
+	double TotalFrameMs = 0.0;
+	for (const double FrameMs : FrameTimesMs)
+	{
+		TotalFrameMs += FrameMs;
+	}
+
+	TSharedRef<FJsonObject> FrameJson = MakeShared<FJsonObject>();
+	FrameJson->SetNumberField(TEXT("avg"), TotalFrameMs / NumFrames);
+	FrameJson->SetNumberField(TEXT("min"), SortedFrameTimes[0]);
+	FrameJson->SetNumberField(TEXT("p50"), SortedFrameTimes[NumFrames / 2]);
+	FrameJson->SetNumberField(TEXT("p95"), SortedFrameTimes[FMath::Min(NumFrames * 95 / 100, NumFrames - 1)]);
+	FrameJson->SetNumberField(TEXT("max"), SortedFrameTimes.Last());
+
+	TSharedRef<FJsonObject> BehaviorTypesJson = MakeShared<FJsonObject>();
+	for (int32 TypeIndex = 0; TypeIndex < BehaviorTypeCounts.Num(); ++TypeIndex)
+	{
+		const EAIBehaviorType Type = static_cast<EAIBehaviorType>(TypeIndex);
+		const double TypeMs = TickManager ? TickManager->GetBehaviorUpdateSeconds(Type) * 1000.0 : 0.0;
+		const int32 NumUpdates = TickManager ? TickManager->GetBehaviorUpdateCount(Type) : 0;
+		const int32 NumTypeAgents = BehaviorTypeCounts[TypeIndex];
+
+		TSharedRef<FJsonObject> TypeJson = MakeShared<FJsonObject>();
+		TypeJson->SetNumberField(TEXT("agents"), NumTypeAgents);
+		TypeJson->SetNumberField(TEXT("updates"), NumUpdates);
+		TypeJson->SetNumberField(TEXT("msPerFrame"), TypeMs / NumFrames);
+		TypeJson->SetNumberField(TEXT("msPerAgent"), NumTypeAgents > 0 ? TypeMs / NumFrames / NumTypeAgents : 0.0);
+		TypeJson->SetNumberField(TEXT("msPerUpdate"), NumUpdates > 0 ? TypeMs / NumUpdates : 0.0);
+		BehaviorTypesJson->SetObjectField(BehaviorTypeEnum->GetNameStringByIndex(TypeIndex), TypeJson);
+	}
+
+	TSharedRef<FJsonObject> CombatRolesJson = MakeShared<FJsonObject>();
+	for (int32 RoleIndex = 0; RoleIndex < NumCombatRoles; ++RoleIndex)
+	{
+		CombatRolesJson->SetNumberField(CombatRoleEnum->GetNameStringByIndex(RoleIndex), CombatRoleCounts[RoleIndex]);
+	}
+
+	TSharedRef<FJsonObject> NavigationJson = MakeShared<FJsonObject>();
+	NavigationJson->SetNumberField(TEXT("requests"), Navigation ? Navigation->GetNavigationStats().TotalRequests - StartRequests : 0);
+	NavigationJson->SetNumberField(TEXT("pathfinds"), Navigation ? Navigation->GetNavigationStats().TotalPathfinds - StartPathfinds : 0);
+
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("map"), MapName);
+	Report->SetNumberField(TEXT("frames"), NumFrames);
+	Report->SetNumberField(TEXT("warmupFrames"), NumWarmupFrames);
+	Report->SetNumberField(TEXT("deltaTime"), DeltaTime);
+	Report->SetNumberField(TEXT("seed"), Seed);
+	Report->SetNumberField(TEXT("agents"), NumAgents);
+	Report->SetObjectField(TEXT("msPerFrame"), FrameJson);
+	Report->SetObjectField(TEXT("behaviorTypes"), BehaviorTypesJson);
+	Report->SetObjectField(TEXT("combatRoles"), CombatRolesJson);
+	Report->SetObjectField(TEXT("navigation"), NavigationJson);
+	Report->SetNumberField(TEXT("lineOfSightTraces"), LineOfSight ? LineOfSight->GetNumTracesDispatched() - StartLineOfSightTraces : 0);
+	Report->SetNumberField(TEXT("spawns"), NumSpawns);
+	Report->SetNumberField(TEXT("dormantAgents"), TickManager ? TickManager->GetDormantCount() : 0);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Report, Writer);
+
+	DestroyWorld(World);
+
+	UE_LOG(LogTemp, Display, TEXT("%s"), *Json);
+
+	if (!FFileHelper::SaveStringToFile(Json, *OutputPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("AIBenchmark: Could not write %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("AIBenchmark: Wrote %s"), *OutputPath);
+	return 0;
+}
+
+// ============================================
+// World
+// ============================================
+
+UWorld* UAIBenchmarkCommandlet::LoadWorld(const FString& MapName) const
+{
+	UPackage* Package = LoadPackage(nullptr, *MapName, LOAD_None);
+	UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (!World) return nullptr;
+
+	// Run as a game world so gameplay subsystems are created
+	World->WorldType = EWorldType::Game;
+	World->AddToRoot();
+
+	// SetGameMode asks the game instance for the game mode, so the world needs one. Standalone
+	// initialization creates the instance's world context with a placeholder world, which the
+	// loaded map then replaces
+	UClass* GameInstanceClass = GetDefault<UGameMapsSettings>()->GameInstanceClass.TryLoadClass<UGameInstance>();
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine, GameInstanceClass ? GameInstanceClass : UGameInstance::StaticClass());
+	GameInstance->AddToRoot();
+	GameInstance->InitializeStandalone();
+
+	FWorldContext* WorldContext = GameInstance->GetWorldContext();
+	if (UWorld* PlaceholderWorld = WorldContext->World())
+	{
+		PlaceholderWorld->DestroyWorld(false);
+	}
+	WorldContext->OwningGameInstance = GameInstance;
+	WorldContext->SetCurrentWorld(World);
+	World->SetGameInstance(GameInstance);
+
+	if (!World->bIsWorldInitialized)
+	{
+		World->InitWorld();
+	}
+
+	const FURL URL;
+	World->SetGameMode(URL);
+	World->UpdateWorldComponents(true, true);
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	return World;
+}
+
+void UAIBenchmarkCommandlet::DestroyWorld(UWorld* World) const
+{
+	UGameInstance* GameInstance = World->GetGameInstance();
+
+	World->BeginTearingDown();
+	if (GameInstance)
+	{
+		GameInstance->Shutdown();
+	}
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+
+	if (GameInstance)
+	{
+		GameInstance->RemoveFromRoot();
+	}
+}
+
+APawn* UAIBenchmarkCommandlet::SpawnAgent(UWorld* World, UClass* AgentClass, const FVector& Center, float Extent, FRandomStream& Random) const
+{
+	FVector Location = Center + FVector(Random.FRandRange(-Extent, Extent), Random.FRandRange(-Extent, Extent), 0.0f);
+
+	// Agents start on the navmesh when there is one
+	if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World))
+	{
+		FNavLocation NavLocation;
+		if (NavSystem->ProjectPointToNavigation(Location, NavLocation, FVector(500.0f, 500.0f, 5000.0f)))
+		{
+			Location = NavLocation.Location + FVector(0.0f, 0.0f, 100.0f);
+		}
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	return World->SpawnActor<APawn>(AgentClass, Location, FRotator(0.0f, Random.FRandRange(0.0f, 360.0f), 0.0f), SpawnParams);
+}
@@ -0,0 +1,49 @@
+// AI Benchmark Commandlet - Headless, reproducible measurement of AI cost
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AIBehaviorTypes.h"
+#include "AIBenchmarkCommandlet.generated.h"
+
+class APawn;
+
+/**
+ * Loads a map without rendering, spawns the requested number of each behavior type and combat
+ * role from the BP_*Enemy classes, then ticks a fixed number of frames while a player pawn walks
+ * a scripted circle. Frame time, per behavior type decision cost, navigation requests, traces
+ * dispatched by the line of sight subsystem (other scene queries are not counted) and spawns are
+ * written as JSON.
+ *
+ * UnrealEditor-Cmd ElementalDanger.uproject -run=AIBenchmark -nullrhi -Passive=200 -AreaGuard=20 -Warrior=10
+ *   -Map=/Game/TestMap -Frames=600 -WarmupFrames=60 -DeltaTime=0.0333 -Seed=1
+ *   -SpawnExtent=8000 -PathRadius=3000 -PathSpeed=600 -Output=Saved/Benchmarks/AIBenchmark.json
+ */
+UCLASS()
+class ELEMENTALDANGER_API UAIBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAIBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+	// Spawned for each behavior type, indexed by EAIBehaviorType
+	UPROPERTY()
+	TArray<TSoftClassPtr<APawn>> BehaviorTypeClasses;
+
+	// Spawned for combat roles, which are then set on its Combat AI component
+	UPROPERTY()
+	TSoftClassPtr<APawn> CombatRoleClass;
+
+	UPROPERTY()
+	TSoftClassPtr<APawn> PlayerClass;
+
+	UWorld* LoadWorld(const FString& MapName) const;
+	void DestroyWorld(UWorld* World) const;
+
+	APawn* SpawnAgent(UWorld* World, UClass* AgentClass, const FVector& Center, float Extent, FRandomStream& Random) const;
+};
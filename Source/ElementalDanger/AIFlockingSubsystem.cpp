@@ -0,0 +1,255 @@
+// AI Flocking Subsystem Implementation
+
+#include "AIFlockingSubsystem.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Async/ParallelFor.h"
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UAIFlockingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAIFlockingSubsystem::Deinitialize()
+{
+	Flocks.Empty();
+	MemberFlocks.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UAIFlockingSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAIFlockingSubsystem, STATGROUP_Tickables);
+}
+
+void UAIFlockingSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (MemberFlocks.Num() == 0) return;
+
+	GatherFlocks();
+
+	const int32 NumMembers = SteeredMembers.Num();
+	if (NumMembers == 0) return;
+
+	// Steering only reads the gathered buffers and writes its own slot
+	ParallelFor(NumMembers, [this](int32 MemberIndex)
+	{
+		ComputeSteering(MemberIndex);
+	}, NumMembers < MinParallelMembers ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	ApplySteering();
+}
+
+// ============================================
+// Membership
+// ============================================
+
+void UAIFlockingSubsystem::JoinFlock(AActor* Leader, ACharacter* Member, float NeighborRadius)
+{
+	if (!Leader || !Member || Leader == Member) return;
+
+	LeaveFlock(Member);
+
+	int32 FlockIndex = Flocks.IndexOfByPredicate([Leader](const FAIFlock& Flock) { return Flock.Leader == Leader; });
+	if (FlockIndex == INDEX_NONE)
+	{
+		FlockIndex = Flocks.AddDefaulted();
+		Flocks[FlockIndex].Leader = Leader;
+	}
+
+	FAIFlock& Flock = Flocks[FlockIndex];
+	Flock.Members.Add(Member);
+	Flock.MemberActive.Add(true);
+	Flock.NeighborRadius = FMath::Max(NeighborRadius, SeparationRadius);
+
+	MemberFlocks.Add(Member, FlockIndex);
+}
+
+void UAIFlockingSubsystem::LeaveFlock(ACharacter* Member)
+{
+	int32 FlockIndex = INDEX_NONE;
+	if (!MemberFlocks.RemoveAndCopyValue(Member, FlockIndex)) return;
+
+	FAIFlock& Flock = Flocks[FlockIndex];
+	const int32 MemberIndex = Flock.Members.Find(Member);
+	if (MemberIndex != INDEX_NONE)
+	{
+		Flock.Members.RemoveAtSwap(MemberIndex);
+		Flock.MemberActive.RemoveAtSwap(MemberIndex);
+	}
+
+	if (Flock.Members.Num() == 0)
+	{
+		RemoveEmptyFlocks();
+	}
+}
+
+void UAIFlockingSubsystem::SetMemberActive(ACharacter* Member, bool bActive)
+{
+	const int32* FlockIndex = MemberFlocks.Find(Member);
+	if (!FlockIndex) return;
+
+	FAIFlock& Flock = Flocks[*FlockIndex];
+	const int32 MemberIndex = Flock.Members.Find(Member);
+	if (MemberIndex != INDEX_NONE)
+	{
+		Flock.MemberActive[MemberIndex] = bActive;
+	}
+}
+
+void UAIFlockingSubsystem::RemoveEmptyFlocks()
+{
+	Flocks.RemoveAll([](const FAIFlock& Flock) { return Flock.Members.Num() == 0; });
+
+	// Flock indices shifted, rebuild the member lookup
+	MemberFlocks.Reset();
+	for (int32 FlockIndex = 0; FlockIndex < Flocks.Num(); ++FlockIndex)
+	{
+		for (ACharacter* Member : Flocks[FlockIndex].Members)
+		{
+			MemberFlocks.Add(Member, FlockIndex);
+		}
+	}
+}
+
+// ============================================
+// Steering
+// ============================================
+
+void UAIFlockingSubsystem::GatherFlocks()
+{
+	SteeredMembers.Reset();
+	Positions.Reset();
+	Velocities.Reset();
+	MaxSpeeds.Reset();
+	MemberFlockSlots.Reset();
+	FlockStarts.Reset();
+	FlockCounts.Reset();
+	FollowPoints.Reset();
+	HasLeader.Reset();
+	NeighborRadii.Reset();
+
+	for (const FAIFlock& Flock : Flocks)
+	{
+		const int32 FlockSlot = FlockStarts.Num();
+		const int32 Start = SteeredMembers.Num();
+
+		for (int32 Index = 0; Index < Flock.Members.Num(); ++Index)
+		{
+			ACharacter* Member = Flock.Members[Index];
+			UCharacterMovementComponent* Movement = IsValid(Member) ? Member->GetCharacterMovement() : nullptr;
+
+			// Paused by behavior, or movement switched off by AI LOD
+			if (!Movement || !Flock.MemberActive[Index] || !Movement->IsComponentTickEnabled()) continue;
+
+			SteeredMembers.Add(Member);
+			Positions.Add(Member->GetActorLocation());
+			Velocities.Add(Movement->Velocity);
+			MaxSpeeds.Add(Movement->GetMaxSpeed());
+			MemberFlockSlots.Add(FlockSlot);
+		}
+
+		// Aim for a point trailing the leader along its heading
+		const AActor* Leader = Flock.Leader;
+		const bool bLeaderValid = IsValid(Leader);
+		FVector FollowPoint = FVector::ZeroVector;
+		if (bLeaderValid)
+		{
+			const FVector LeaderVelocity = Leader->GetVelocity();
+			const FVector Heading = LeaderVelocity.SizeSquared2D() > 1.0f ? LeaderVelocity.GetSafeNormal2D() : Leader->GetActorForwardVector().GetSafeNormal2D();
+			FollowPoint = Leader->GetActorLocation() - Heading * LeaderFollowDistance;
+		}
+
+		FlockStarts.Add(Start);
+		FlockCounts.Add(SteeredMembers.Num() - Start);
+		FollowPoints.Add(FollowPoint);
+		HasLeader.Add(bLeaderValid);
+		NeighborRadii.Add(Flock.NeighborRadius);
+	}
+
+	DesiredVelocities.SetNumUninitialized(SteeredMembers.Num(), EAllowShrinking::No);
+}
+
+void UAIFlockingSubsystem::ComputeSteering(int32 MemberIndex)
+{
+	const int32 FlockSlot = MemberFlockSlots[MemberIndex];
+	const int32 Start = FlockStarts[FlockSlot];
+	const int32 End = Start + FlockCounts[FlockSlot];
+
+	const FVector Position = Positions[MemberIndex];
+	const float MaxSpeed = MaxSpeeds[MemberIndex];
+	const float NeighborRadiusSq = FMath::Square(NeighborRadii[FlockSlot]);
+	const float SeparationRadiusSq = FMath::Square(SeparationRadius);
+
+	FVector Separation = FVector::ZeroVector;
+	FVector VelocitySum = FVector::ZeroVector;
+	FVector PositionSum = FVector::ZeroVector;
+	int32 NumNeighbors = 0;
+
+	for (int32 Other = Start; Other < End; ++Other)
+	{
+		if (Other == MemberIndex) continue;
+
+		FVector Offset = Position - Positions[Other];
+		Offset.Z = 0.0f;
+		const float DistanceSq = Offset.SizeSquared();
+		if (DistanceSq > NeighborRadiusSq) continue;
+
+		++NumNeighbors;
+		VelocitySum += Velocities[Other];
+		PositionSum += Positions[Other];
+
+		// Push harder the closer the neighbor is
+		if (DistanceSq < SeparationRadiusSq && DistanceSq > KINDA_SMALL_NUMBER)
+		{
+			const float Distance = FMath::Sqrt(DistanceSq);
+			Separation += (Offset / Distance) * (1.0f - Distance / SeparationRadius) * MaxSpeed;
+		}
+	}
+
+	FVector Desired = Separation * SeparationWeight;
+
+	if (NumNeighbors > 0)
+	{
+		const FVector Alignment = VelocitySum / NumNeighbors;
+		FVector ToCenter = PositionSum / NumNeighbors - Position;
+		ToCenter.Z = 0.0f;
+		const FVector Cohesion = ToCenter.GetClampedToMaxSize(MaxSpeed);
+
+		Desired += Alignment * AlignmentWeight + Cohesion * CohesionWeight;
+	}
+
+	if (HasLeader[FlockSlot])
+	{
+		FVector ToFollowPoint = FollowPoints[FlockSlot] - Position;
+		ToFollowPoint.Z = 0.0f;
+		const float Distance = ToFollowPoint.Size();
+		const float ArrivalSpeed = MaxSpeed * FMath::Clamp(Distance / FMath::Max(ArrivalDistance, 1.0f), 0.0f, 1.0f);
+
+		Desired += ToFollowPoint.GetSafeNormal() * ArrivalSpeed * LeaderFollowWeight;
+	}
+
+	Desired.Z = 0.0f;
+	Desired = Desired.GetClampedToMaxSize(MaxSpeed);
+
+	DesiredVelocities[MemberIndex] = Desired.SizeSquared() < FMath::Square(MinSteeringSpeed) ? FVector::ZeroVector : Desired;
+}
+
+void UAIFlockingSubsystem::ApplySteering()
+{
+	for (int32 MemberIndex = 0; MemberIndex < SteeredMembers.Num(); ++MemberIndex)
+	{
+		const FVector& Desired = DesiredVelocities[MemberIndex];
+		if (Desired.IsZero() || MaxSpeeds[MemberIndex] <= 0.0f) continue;
+
+		// Movement input scaled so the character accelerates towards the desired velocity
+		SteeredMembers[MemberIndex]->AddMovementInput(Desired.GetSafeNormal(), Desired.Size() / MaxSpeeds[MemberIndex]);
+	}
+}
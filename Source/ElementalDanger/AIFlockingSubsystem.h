@@ -0,0 +1,132 @@
+// AI Flocking Subsystem - Boids steering for neutral groups following a leader
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AIFlockingSubsystem.generated.h"
+
+class ACharacter;
+
+/**
+ * A leader and the members steering after it
+ */
+USTRUCT()
+struct FAIFlock
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	AActor* Leader = nullptr;
+
+	UPROPERTY()
+	TArray<ACharacter*> Members;
+
+	// Members paused by their behavior (e.g. while fighting), index-aligned with Members
+	TArray<bool> MemberActive;
+
+	// Members within this distance of each other count as neighbors
+	float NeighborRadius = 300.0f;
+};
+
+/**
+ * Moves group members together without per-member pathfinding.
+ * Each tick every flock is flattened into structure-of-arrays position/velocity buffers,
+ * separation/alignment/cohesion/leader-follow steering runs in a ParallelFor, and the
+ * resulting desired velocities are fed to the members as movement input.
+ * Leaders keep moving with their own behavior and navigation.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UAIFlockingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ============================================
+	// Configuration
+	// ============================================
+
+	// Members closer than this push apart
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flocking")
+	float SeparationRadius = 150.0f;
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flocking")
+	float SeparationWeight = 1.5f;
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flocking")
+	float AlignmentWeight = 0.5f;
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flocking")
+	float CohesionWeight = 0.5f;
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flocking")
+	float LeaderFollowWeight = 1.0f;
+
+	// How far behind the leader members aim for
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flocking")
+	float LeaderFollowDistance = 200.0f;
+
+	// Members slow down within this distance of their follow point
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flocking")
+	float ArrivalDistance = 300.0f;
+
+	// Desired speeds below this are treated as standing still
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flocking")
+	float MinSteeringSpeed = 20.0f;
+
+	// Fewer members than this are steered on the game thread
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flocking")
+	int32 MinParallelMembers = 64;
+
+	// ============================================
+	// Membership
+	// ============================================
+
+	void JoinFlock(AActor* Leader, ACharacter* Member, float NeighborRadius);
+	void LeaveFlock(ACharacter* Member);
+
+	// Paused members keep their flock but are not steered
+	void SetMemberActive(ACharacter* Member, bool bActive);
+
+	bool IsFlocking(const ACharacter* Member) const { return MemberFlocks.Contains(Member); }
+
+	UFUNCTION(BlueprintCallable, Category = "AI Flocking")
+	int32 GetNumFlockingMembers() const { return MemberFlocks.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	UPROPERTY()
+	TArray<FAIFlock> Flocks;
+
+	// Member to index in Flocks
+	TMap<ACharacter*, int32> MemberFlocks;
+
+	// Per-member SoA buffers, rebuilt each tick with every flock's members contiguous
+	TArray<ACharacter*> SteeredMembers;
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<float> MaxSpeeds;
+	TArray<int32> MemberFlockSlots;
+	TArray<FVector> DesiredVelocities;
+
+	// Per-flock buffers
+	TArray<int32> FlockStarts;
+	TArray<int32> FlockCounts;
+	TArray<FVector> FollowPoints;
+	TArray<bool> HasLeader;
+	TArray<float> NeighborRadii;
+
+	void GatherFlocks();
+	void ComputeSteering(int32 MemberIndex);
+	void ApplySteering();
+	void RemoveEmptyFlocks();
+};
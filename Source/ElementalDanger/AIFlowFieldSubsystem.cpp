@@ -0,0 +1,381 @@
+// AI Flow Field Subsystem Implementation
+
+#include "AIFlowFieldSubsystem.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "NavigationSystem.h"
+
+namespace
+{
+	const FIntPoint NeighborOffsets[8] =
+	{
+		FIntPoint(1, 0), FIntPoint(-1, 0), FIntPoint(0, 1), FIntPoint(0, -1),
+		FIntPoint(1, 1), FIntPoint(1, -1), FIntPoint(-1, 1), FIntPoint(-1, -1)
+	};
+
+	struct FOpenCell
+	{
+		float Cost;
+		int32 Index;
+
+		bool operator<(const FOpenCell& Other) const { return Cost < Other.Cost; }
+	};
+}
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UAIFlowFieldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAIFlowFieldSubsystem::Deinitialize()
+{
+	Fields.Empty();
+	PursuerTargets.Empty();
+	SteeredPursuers.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UAIFlowFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAIFlowFieldSubsystem, STATGROUP_Tickables);
+}
+
+void UAIFlowFieldSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	bool bHasDestroyedPursuers = false;
+
+	for (auto It = Fields.CreateIterator(); It; ++It)
+	{
+		FAIFlowField& Field = It.Value();
+		bHasDestroyedPursuers |= Field.Pursuers.RemoveAllSwap([](const TWeakObjectPtr<APawn>& Pursuer) { return !Pursuer.IsValid(); }) > 0;
+
+		if (!Field.Target.IsValid() || Field.Pursuers.Num() == 0)
+		{
+			for (const TWeakObjectPtr<APawn>& Pursuer : Field.Pursuers)
+			{
+				PursuerTargets.Remove(Pursuer.Get());
+				SteeredPursuers.Remove(Pursuer.Get());
+			}
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// Small groups path individually
+		if (Field.Pursuers.Num() < MinPursuersForField)
+		{
+			for (const TWeakObjectPtr<APawn>& Pursuer : Field.Pursuers)
+			{
+				SteeredPursuers.Remove(Pursuer.Get());
+			}
+			continue;
+		}
+
+		UpdateField(Field);
+		SteerPursuers(Field);
+	}
+
+	if (bHasDestroyedPursuers)
+	{
+		for (auto It = PursuerTargets.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().ResolveObjectPtr())
+			{
+				It.RemoveCurrent();
+			}
+		}
+		for (auto It = SteeredPursuers.CreateIterator(); It; ++It)
+		{
+			if (!It->ResolveObjectPtr())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+// ============================================
+// Pursuit
+// ============================================
+
+void UAIFlowFieldSubsystem::SetPursuitTarget(APawn* Pursuer, AActor* Target)
+{
+	if (!Pursuer || !Target) return;
+
+	if (const TObjectKey<AActor>* CurrentTarget = PursuerTargets.Find(Pursuer))
+	{
+		if (*CurrentTarget == TObjectKey<AActor>(Target)) return;
+
+		ClearPursuit(Pursuer);
+	}
+
+	FAIFlowField& Field = Fields.FindOrAdd(Target);
+	Field.Target = Target;
+	Field.Pursuers.Add(Pursuer);
+
+	PursuerTargets.Add(Pursuer, Target);
+}
+
+void UAIFlowFieldSubsystem::ClearPursuit(APawn* Pursuer)
+{
+	TObjectKey<AActor> TargetKey;
+	if (!Pursuer || !PursuerTargets.RemoveAndCopyValue(Pursuer, TargetKey)) return;
+
+	SteeredPursuers.Remove(Pursuer);
+
+	if (FAIFlowField* Field = Fields.Find(TargetKey))
+	{
+		Field->Pursuers.RemoveSingleSwap(Pursuer, EAllowShrinking::No);
+	}
+}
+
+int32 UAIFlowFieldSubsystem::GetNumPursuers(AActor* Target) const
+{
+	const FAIFlowField* Field = Fields.Find(Target);
+	return Field ? Field->Pursuers.Num() : 0;
+}
+
+int32 UAIFlowFieldSubsystem::GetNumActiveFields() const
+{
+	int32 NumActive = 0;
+	for (const auto& Pair : Fields)
+	{
+		NumActive += Pair.Value.Pursuers.Num() >= MinPursuersForField ? 1 : 0;
+	}
+
+	return NumActive;
+}
+
+bool UAIFlowFieldSubsystem::SampleDirection(const AActor* Target, const FVector& Location, FVector& OutDirection) const
+{
+	const FAIFlowField* Field = Fields.Find(Target);
+	if (!Field || Field->Costs.Num() == 0) return false;
+
+	const int32 Index = GetCellIndex(*Field, GetWorldCell(Location));
+	if (Index == INDEX_NONE || Field->Costs[Index] == MAX_flt) return false;
+
+	const FVector2f& Direction = Field->Directions[Index];
+	if (Direction.IsNearlyZero()) return false;
+
+	OutDirection = FVector(Direction.X, Direction.Y, 0.0f);
+	return true;
+}
+
+void UAIFlowFieldSubsystem::SteerPursuers(FAIFlowField& Field)
+{
+	const AActor* Target = Field.Target.Get();
+	const FVector TargetLocation = Target->GetActorLocation();
+
+	for (const TWeakObjectPtr<APawn>& PursuerPtr : Field.Pursuers)
+	{
+		APawn* Pursuer = PursuerPtr.Get();
+
+		// Movement switched off by AI LOD
+		const UPawnMovementComponent* Movement = Pursuer->GetMovementComponent();
+		if (!Movement || !Movement->IsComponentTickEnabled())
+		{
+			SteeredPursuers.Remove(Pursuer);
+			continue;
+		}
+
+		FVector ToTarget = TargetLocation - Pursuer->GetActorLocation();
+		ToTarget.Z = 0.0f;
+
+		FVector Direction;
+		if (ToTarget.SizeSquared() <= FMath::Square(DirectApproachDistance))
+		{
+			Direction = ToTarget.GetSafeNormal();
+		}
+		else if (!SampleDirection(Target, Pursuer->GetActorLocation(), Direction))
+		{
+			// Outside the field, back to regular pathing
+			SteeredPursuers.Remove(Pursuer);
+			continue;
+		}
+
+		Pursuer->AddMovementInput(Direction);
+		SteeredPursuers.Add(Pursuer);
+	}
+}
+
+// ============================================
+// Field
+// ============================================
+
+FIntPoint UAIFlowFieldSubsystem::GetWorldCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+int32 UAIFlowFieldSubsystem::GetCellIndex(const FAIFlowField& Field, const FIntPoint& WorldCell) const
+{
+	const FIntPoint Local = WorldCell - Field.OriginCell;
+	if (!Field.bSampled || Local.X < 0 || Local.Y < 0 || Local.X >= GridSize || Local.Y >= GridSize) return INDEX_NONE;
+
+	return Local.Y * GridSize + Local.X;
+}
+
+void UAIFlowFieldSubsystem::UpdateField(FAIFlowField& Field)
+{
+	const FIntPoint TargetCell = GetWorldCell(Field.Target->GetActorLocation());
+	const FIntPoint HalfGrid(GridSize / 2, GridSize / 2);
+	const FIntPoint Offset = TargetCell - (Field.OriginCell + HalfGrid);
+
+	// Shift the grid once the target has moved a quarter of it off center
+	if (!Field.bSampled || FMath::Abs(Offset.X) > GridSize / 4 || FMath::Abs(Offset.Y) > GridSize / 4)
+	{
+		SampleCells(Field, TargetCell - HalfGrid);
+	}
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (TargetCell != Field.IntegratedTargetCell && Now - Field.LastIntegrationTime >= MinIntegrationInterval)
+	{
+		IntegrateField(Field, TargetCell);
+		Field.LastIntegrationTime = Now;
+	}
+}
+
+void UAIFlowFieldSubsystem::SampleCells(FAIFlowField& Field, const FIntPoint& NewOriginCell)
+{
+	UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	const int32 NumCells = GridSize * GridSize;
+	const float ReferenceZ = Field.Target->GetActorLocation().Z;
+	const FVector ProjectionExtent(CellSize * 0.5f, CellSize * 0.5f, ProjectionHeight);
+
+	TArray<float> Heights;
+	TArray<bool> Walkable;
+	Heights.SetNumZeroed(NumCells);
+	Walkable.Init(false, NumCells);
+
+	for (int32 Y = 0; Y < GridSize; ++Y)
+	{
+		for (int32 X = 0; X < GridSize; ++X)
+		{
+			const int32 Index = Y * GridSize + X;
+			const FIntPoint WorldCell = NewOriginCell + FIntPoint(X, Y);
+
+			// Cells still covered after the shift keep their samples
+			const int32 OldIndex = GetCellIndex(Field, WorldCell);
+			if (OldIndex != INDEX_NONE)
+			{
+				Heights[Index] = Field.Heights[OldIndex];
+				Walkable[Index] = Field.Walkable[OldIndex];
+				continue;
+			}
+
+			const FVector CellCenter((WorldCell.X + 0.5f) * CellSize, (WorldCell.Y + 0.5f) * CellSize, ReferenceZ);
+			FNavLocation NavLocation;
+			if (NavSystem && NavSystem->ProjectPointToNavigation(CellCenter, NavLocation, ProjectionExtent))
+			{
+				Heights[Index] = NavLocation.Location.Z;
+				Walkable[Index] = true;
+			}
+		}
+	}
+
+	Field.Heights = MoveTemp(Heights);
+	Field.Walkable = MoveTemp(Walkable);
+	Field.OriginCell = NewOriginCell;
+	Field.bSampled = true;
+
+	// Old costs are indexed by the previous origin
+	Field.IntegratedTargetCell = FIntPoint(MAX_int32, MAX_int32);
+	Field.LastIntegrationTime = -UE_BIG_NUMBER;
+}
+
+void UAIFlowFieldSubsystem::IntegrateField(FAIFlowField& Field, const FIntPoint& TargetCell)
+{
+	const int32 NumCells = GridSize * GridSize;
+	Field.Costs.Init(MAX_flt, NumCells);
+	Field.Directions.Init(FVector2f::ZeroVector, NumCells);
+	Field.IntegratedTargetCell = TargetCell;
+
+	// Diagonals may not cut corners
+	auto CanStep = [this, &Field](int32 X, int32 Y, const FIntPoint& Step) -> bool
+	{
+		const int32 NX = X + Step.X;
+		const int32 NY = Y + Step.Y;
+		if (NX < 0 || NY < 0 || NX >= GridSize || NY >= GridSize) return false;
+
+		const int32 NeighborIndex = NY * GridSize + NX;
+		if (!Field.Walkable[NeighborIndex]) return false;
+		if (FMath::Abs(Field.Heights[NeighborIndex] - Field.Heights[Y * GridSize + X]) > MaxHeightDifference) return false;
+
+		return Step.X == 0 || Step.Y == 0 || (Field.Walkable[Y * GridSize + NX] && Field.Walkable[NY * GridSize + X]);
+	};
+
+	// Target standing just off the navmesh, start from a walkable neighbor
+	int32 GoalIndex = GetCellIndex(Field, TargetCell);
+	if (GoalIndex == INDEX_NONE || !Field.Walkable[GoalIndex])
+	{
+		GoalIndex = INDEX_NONE;
+		for (const FIntPoint& Step : NeighborOffsets)
+		{
+			const int32 NeighborIndex = GetCellIndex(Field, TargetCell + Step);
+			if (NeighborIndex != INDEX_NONE && Field.Walkable[NeighborIndex])
+			{
+				GoalIndex = NeighborIndex;
+				break;
+			}
+		}
+		if (GoalIndex == INDEX_NONE) return;
+	}
+
+	TArray<FOpenCell> Open;
+	Field.Costs[GoalIndex] = 0.0f;
+	Open.HeapPush({ 0.0f, GoalIndex });
+
+	while (Open.Num() > 0)
+	{
+		FOpenCell Current;
+		Open.HeapPop(Current, EAllowShrinking::No);
+		if (Current.Cost > Field.Costs[Current.Index]) continue;
+
+		const int32 X = Current.Index % GridSize;
+		const int32 Y = Current.Index / GridSize;
+
+		for (const FIntPoint& Step : NeighborOffsets)
+		{
+			if (!CanStep(X, Y, Step)) continue;
+
+			const int32 NeighborIndex = (Y + Step.Y) * GridSize + (X + Step.X);
+			const float NewCost = Current.Cost + (Step.X != 0 && Step.Y != 0 ? UE_SQRT_2 : 1.0f);
+			if (NewCost < Field.Costs[NeighborIndex])
+			{
+				Field.Costs[NeighborIndex] = NewCost;
+				Open.HeapPush({ NewCost, NeighborIndex });
+			}
+		}
+	}
+
+	// Every reachable cell points at its cheapest neighbor
+	for (int32 Index = 0; Index < NumCells; ++Index)
+	{
+		if (Index == GoalIndex || Field.Costs[Index] == MAX_flt) continue;
+
+		const int32 X = Index % GridSize;
+		const int32 Y = Index / GridSize;
+		float BestCost = Field.Costs[Index];
+		FIntPoint BestStep = FIntPoint::ZeroValue;
+
+		for (const FIntPoint& Step : NeighborOffsets)
+		{
+			if (!CanStep(X, Y, Step)) continue;
+
+			const float NeighborCost = Field.Costs[(Y + Step.Y) * GridSize + (X + Step.X)];
+			if (NeighborCost < BestCost)
+			{
+				BestCost = NeighborCost;
+				BestStep = Step;
+			}
+		}
+
+		Field.Directions[Index] = FVector2f(BestStep.X, BestStep.Y).GetSafeNormal();
+	}
+}
@@ -0,0 +1,123 @@
+// AI Flow Field Subsystem - Shared navmesh flow fields for groups pursuing the same target
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AIFlowFieldSubsystem.generated.h"
+
+class APawn;
+
+/**
+ * Grid around one target with the direction towards it from every reachable cell
+ */
+struct FAIFlowField
+{
+	TWeakObjectPtr<AActor> Target;
+	TArray<TWeakObjectPtr<APawn>> Pursuers;
+
+	// World cell of the grid's first cell, the grid spans GridSize cells on each axis
+	FIntPoint OriginCell = FIntPoint::ZeroValue;
+	bool bSampled = false;
+
+	// Per cell, index = Y * GridSize + X
+	TArray<float> Heights;
+	TArray<bool> Walkable;
+	TArray<float> Costs;
+	TArray<FVector2f> Directions;
+
+	// Cell the field was last integrated towards
+	FIntPoint IntegratedTargetCell = FIntPoint(MAX_int32, MAX_int32);
+	double LastIntegrationTime = -UE_BIG_NUMBER;
+};
+
+/**
+ * When many agents chase one target they share a flow field instead of pathing individually.
+ * The field is a grid centered on the target whose cells are projected onto the navmesh once;
+ * as the target moves it is re-integrated (Dijkstra from the target cell) and, when the target
+ * nears the grid edge, shifted so only newly covered cells are sampled.
+ * Each tick steered pursuers look up their cell's direction in O(1) and receive it as
+ * movement input. Pursuers of targets with fewer than MinPursuersForField agents, or standing
+ * outside the field, are left to regular pathing.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UAIFlowFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ============================================
+	// Configuration
+	// ============================================
+
+	// Fewer pursuers than this keep pathing individually
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flow Field")
+	int32 MinPursuersForField = 6;
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flow Field")
+	float CellSize = 200.0f;
+
+	// Cells per side of the grid around the target
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flow Field")
+	int32 GridSize = 48;
+
+	// Neighboring cells further apart in height than this are not connected
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flow Field")
+	float MaxHeightDifference = 120.0f;
+
+	// Vertical search extent when projecting cells onto the navmesh
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flow Field")
+	float ProjectionHeight = 500.0f;
+
+	// Minimum seconds between re-integrations of one field
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flow Field")
+	float MinIntegrationInterval = 0.1f;
+
+	// Pursuers this close to the target head straight at it
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Flow Field")
+	float DirectApproachDistance = 300.0f;
+
+	// ============================================
+	// Pursuit
+	// ============================================
+
+	// Registers or moves Pursuer to the group chasing Target
+	void SetPursuitTarget(APawn* Pursuer, AActor* Target);
+	void ClearPursuit(APawn* Pursuer);
+
+	// True while the field is moving Pursuer, its own path should be stopped
+	bool IsSteering(const APawn* Pursuer) const { return SteeredPursuers.Contains(Pursuer); }
+
+	// Direction towards Target from Location, false outside the field or where it is unreachable
+	bool SampleDirection(const AActor* Target, const FVector& Location, FVector& OutDirection) const;
+
+	UFUNCTION(BlueprintCallable, Category = "AI Flow Field")
+	int32 GetNumPursuers(AActor* Target) const;
+
+	UFUNCTION(BlueprintCallable, Category = "AI Flow Field")
+	int32 GetNumActiveFields() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	TMap<TObjectKey<AActor>, FAIFlowField> Fields;
+	TMap<TObjectKey<APawn>, TObjectKey<AActor>> PursuerTargets;
+	TSet<TObjectKey<APawn>> SteeredPursuers;
+
+	void UpdateField(FAIFlowField& Field);
+	void SampleCells(FAIFlowField& Field, const FIntPoint& NewOriginCell);
+	void IntegrateField(FAIFlowField& Field, const FIntPoint& TargetCell);
+	void SteerPursuers(FAIFlowField& Field);
+
+	FIntPoint GetWorldCell(const FVector& Location) const;
+	int32 GetCellIndex(const FAIFlowField& Field, const FIntPoint& WorldCell) const;
+};
@@ -0,0 +1,127 @@
+// AI Group Implementation
+
+#include "AIGroup.h"
+#include "AIBehaviorComponent.h"
+#include "NinjaWizardCharacter.h"
+#include "Engine/World.h"
+
+// ============================================
+// Membership
+// ============================================
+
+void UAIGroup::AddMember(UAIBehaviorComponent* Member)
+{
+	if (!Member) return;
+
+	Members.AddUnique(Member);
+
+	if (!Leader)
+	{
+		SetLeader(Member->GetOwner());
+	}
+}
+
+void UAIGroup::RemoveMember(UAIBehaviorComponent* Member)
+{
+	if (Members.Remove(Member) == 0) return;
+
+	if (Member && Member->GetOwner() == Leader)
+	{
+		ElectLeader();
+	}
+}
+
+TArray<AActor*> UAIGroup::GetMemberActors() const
+{
+	TArray<AActor*> MemberActors;
+	MemberActors.Reserve(Members.Num());
+
+	for (const UAIBehaviorComponent* Member : Members)
+	{
+		if (Member && Member->GetOwner())
+		{
+			MemberActors.Add(Member->GetOwner());
+		}
+	}
+
+	return MemberActors;
+}
+
+bool UAIGroup::HasMember(const AActor* Actor) const
+{
+	return Actor && Members.ContainsByPredicate([Actor](const UAIBehaviorComponent* Member)
+	{
+		return Member && Member->GetOwner() == Actor;
+	});
+}
+
+// ============================================
+// Leadership
+// ============================================
+
+void UAIGroup::SetLeader(AActor* NewLeader)
+{
+	if (Leader == NewLeader) return;
+
+	Leader = NewLeader;
+
+	// Members re-target their flock steering at the new leader
+	for (UAIBehaviorComponent* Member : Members)
+	{
+		if (Member)
+		{
+			Member->OnGroupLeaderChanged();
+		}
+	}
+}
+
+void UAIGroup::ElectLeader()
+{
+	Members.Remove(nullptr);
+
+	SetLeader(Members.Num() > 0 ? Members[0]->GetOwner() : nullptr);
+}
+
+// ============================================
+// Alert
+// ============================================
+
+void UAIGroup::RaiseAlert(ANinjaWizardCharacter* Target, float Duration, float LeashRadius)
+{
+	if (!Target) return;
+
+	SharedTarget = Target;
+	AlertState = EAIGroupAlertState::Alerted;
+	AlertExpiryTime = (GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0) + Duration;
+	AlertLeashRadius = LeashRadius;
+}
+
+void UAIGroup::ClearAlert()
+{
+	SharedTarget = nullptr;
+	AlertState = EAIGroupAlertState::Calm;
+}
+
+void UAIGroup::ClearLapsedAlert()
+{
+	if (AlertState == EAIGroupAlertState::Alerted && !IsAlerted())
+	{
+		ClearAlert();
+	}
+}
+
+bool UAIGroup::IsAlerted() const
+{
+	if (AlertState != EAIGroupAlertState::Alerted || !IsValid(SharedTarget) || SharedTarget->IsDead())
+	{
+		return false;
+	}
+
+	if (GetWorld() && GetWorld()->GetTimeSeconds() >= AlertExpiryTime)
+	{
+		return false;
+	}
+
+	return !IsValid(Leader) ||
+		FVector::DistSquared(Leader->GetActorLocation(), SharedTarget->GetActorLocation()) <= FMath::Square(AlertLeashRadius);
+}
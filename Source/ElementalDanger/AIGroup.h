@@ -0,0 +1,103 @@
+// AI Group - Shared blackboard for a pack of behavior components
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "AIGroup.generated.h"
+
+class UAIBehaviorComponent;
+class ANinjaWizardCharacter;
+
+/**
+ * Group alert states
+ */
+UENUM(BlueprintType)
+enum class EAIGroupAlertState : uint8
+{
+	Calm            UMETA(DisplayName = "Calm"),
+	Alerted         UMETA(DisplayName = "Alerted - Fighting Shared Target")
+};
+
+/**
+ * State shared by every member of a pack: leader, members, shared target and alert state.
+ * Members hold a reference to the same group, so joining a fight, electing a leader or
+ * calling for help is a single write every member sees on its next update.
+ */
+UCLASS(BlueprintType)
+class ELEMENTALDANGER_API UAIGroup : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Membership
+	// ============================================
+
+	void AddMember(UAIBehaviorComponent* Member);
+	void RemoveMember(UAIBehaviorComponent* Member);
+
+	UFUNCTION(BlueprintCallable, Category = "AI Group")
+	TArray<AActor*> GetMemberActors() const;
+
+	UFUNCTION(BlueprintCallable, Category = "AI Group")
+	int32 GetNumMembers() const { return Members.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category = "AI Group")
+	bool HasMember(const AActor* Actor) const;
+
+	// ============================================
+	// Leadership
+	// ============================================
+
+	UFUNCTION(BlueprintCallable, Category = "AI Group")
+	AActor* GetLeader() const { return Leader; }
+
+	UFUNCTION(BlueprintCallable, Category = "AI Group")
+	void SetLeader(AActor* NewLeader);
+
+	// Promotes the first remaining member, called when the leader leaves
+	void ElectLeader();
+
+	// ============================================
+	// Alert
+	// ============================================
+
+	// Every member joins the fight against Target on its next update. Raising it again refreshes
+	// the duration. The alert lapses after Duration seconds, when Target dies or when Target is
+	// further than LeashRadius from the leader.
+	UFUNCTION(BlueprintCallable, Category = "AI Group")
+	void RaiseAlert(ANinjaWizardCharacter* Target, float Duration = 30.0f, float LeashRadius = 3000.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "AI Group")
+	void ClearAlert();
+
+	// Clears an alert that has lapsed, called by members on their update
+	void ClearLapsedAlert();
+
+	// True while the alert is raised and has not lapsed
+	UFUNCTION(BlueprintCallable, Category = "AI Group")
+	bool IsAlerted() const;
+
+	UFUNCTION(BlueprintCallable, Category = "AI Group")
+	ANinjaWizardCharacter* GetSharedTarget() const { return SharedTarget; }
+
+	UFUNCTION(BlueprintCallable, Category = "AI Group")
+	EAIGroupAlertState GetAlertState() const { return AlertState; }
+
+protected:
+	UPROPERTY()
+	AActor* Leader = nullptr;
+
+	UPROPERTY()
+	TArray<UAIBehaviorComponent*> Members;
+
+	UPROPERTY()
+	ANinjaWizardCharacter* SharedTarget = nullptr;
+
+	UPROPERTY()
+	EAIGroupAlertState AlertState = EAIGroupAlertState::Calm;
+
+	double AlertExpiryTime = 0.0;
+	float AlertLeashRadius = 0.0f;
+};
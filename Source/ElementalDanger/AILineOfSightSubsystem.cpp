@@ -0,0 +1,192 @@
+// AI Line Of Sight Subsystem Implementation
+
+#include "AILineOfSightSubsystem.h"
+#include "Engine/World.h"
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UAILineOfSightSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAILineOfSightSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TraceDelegate.BindUObject(this, &UAILineOfSightSubsystem::OnTraceCompleted);
+}
+
+void UAILineOfSightSubsystem::Deinitialize()
+{
+	TraceDelegate.Unbind();
+
+	TargetCaches.Empty();
+	QueuedRequests.Empty();
+	InFlightRequests.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UAILineOfSightSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAILineOfSightSubsystem, STATGROUP_Tickables);
+}
+
+void UAILineOfSightSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	PruneExpiredResults(GetWorld()->GetTimeSeconds());
+	DispatchQueuedRequests();
+}
+
+// ============================================
+// Queries
+// ============================================
+
+bool UAILineOfSightSubsystem::HasLineOfSight(AActor* Viewer, AActor* Target)
+{
+	if (!Viewer || !Target) return false;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const FVector ViewerLocation = Viewer->GetActorLocation();
+	const FVector TargetLocation = Target->GetActorLocation();
+
+	FAILOSTargetCache& Cache = TargetCaches.FindOrAdd(Target);
+
+	// Nearest usable result: any viewer within tolerance, or this viewer's own last result
+	const FAILOSSample* Shared = nullptr;
+	const FAILOSSample* Own = nullptr;
+	for (const FAILOSSample& Sample : Cache.Results)
+	{
+		if (Sample.Viewer == Viewer)
+		{
+			Own = &Sample;
+		}
+		if (IsWithinTolerance(Sample, ViewerLocation, TargetLocation) && (!Shared || Sample.Time > Shared->Time))
+		{
+			Shared = &Sample;
+		}
+	}
+
+	if (Shared && Now - Shared->Time <= StalenessWindow)
+	{
+		return Shared->bVisible;
+	}
+
+	// Stale or missing, refresh unless a matching trace is already on its way
+	const bool bRefreshPending = Cache.Pending.ContainsByPredicate([&](const FAILOSSample& Sample)
+	{
+		return IsWithinTolerance(Sample, ViewerLocation, TargetLocation);
+	});
+
+	const bool bFallbackVisible = Shared ? Shared->bVisible : (Own && Own->bVisible);
+
+	if (!bRefreshPending)
+	{
+		QueueRequest(Cache, Viewer, Target, ViewerLocation, TargetLocation);
+	}
+
+	return bFallbackVisible;
+}
+
+bool UAILineOfSightSubsystem::IsWithinTolerance(const FAILOSSample& Sample, const FVector& ViewerLocation, const FVector& TargetLocation) const
+{
+	const float ToleranceSq = FMath::Square(SpatialTolerance);
+	return FVector::DistSquared(Sample.ViewerLocation, ViewerLocation) <= ToleranceSq
+		&& FVector::DistSquared(Sample.TargetLocation, TargetLocation) <= ToleranceSq;
+}
+
+// ============================================
+// Trace Dispatch
+// ============================================
+
+void UAILineOfSightSubsystem::QueueRequest(FAILOSTargetCache& Cache, AActor* Viewer, AActor* Target,
+	const FVector& ViewerLocation, const FVector& TargetLocation)
+{
+	FAILOSRequest& Request = QueuedRequests.AddDefaulted_GetRef();
+	Request.RequestId = NextRequestId++;
+	Request.Viewer = Viewer;
+	Request.Target = Target;
+	Request.TargetKey = Target;
+	Request.Start = ViewerLocation;
+	Request.End = TargetLocation;
+
+	FAILOSSample& Placeholder = Cache.Pending.AddDefaulted_GetRef();
+	Placeholder.Viewer = Viewer;
+	Placeholder.ViewerLocation = ViewerLocation;
+	Placeholder.TargetLocation = TargetLocation;
+	Placeholder.RequestId = Request.RequestId;
+}
+
+void UAILineOfSightSubsystem::DispatchQueuedRequests()
+{
+	UWorld* World = GetWorld();
+	const int32 NumToDispatch = FMath::Min(QueuedRequests.Num(), FMath::Max(MaxTracesPerFrame, 1));
+
+	for (int32 Index = 0; Index < NumToDispatch; ++Index)
+	{
+		const FAILOSRequest& Request = QueuedRequests[Index];
+
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AILineOfSight), false);
+		if (AActor* Viewer = Request.Viewer.Get())
+		{
+			QueryParams.AddIgnoredActor(Viewer);
+		}
+
+		World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Request.Start, Request.End, ECC_Visibility,
+			QueryParams, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, Request.RequestId);
+
+		InFlightRequests.Add(Request.RequestId, Request);
+		++NumTracesDispatched;
+	}
+
+	QueuedRequests.RemoveAt(0, NumToDispatch, EAllowShrinking::No);
+}
+
+void UAILineOfSightSubsystem::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	FAILOSRequest Request;
+	if (!InFlightRequests.RemoveAndCopyValue(Datum.UserData, Request)) return;
+
+	FAILOSTargetCache* Cache = TargetCaches.Find(Request.TargetKey);
+	if (!Cache) return;
+
+	Cache->Pending.RemoveAllSwap([&](const FAILOSSample& Sample) { return Sample.RequestId == Request.RequestId; });
+
+	// Destroyed target, the cache is pruned once nothing is pending
+	AActor* Target = Request.Target.Get();
+	if (!Target) return;
+
+	const FHitResult* BlockingHit = Datum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+
+	const TObjectKey<AActor> ViewerKey(Request.Viewer.Get());
+	FAILOSSample* Result = Cache->Results.FindByPredicate([&](const FAILOSSample& Sample) { return Sample.Viewer == ViewerKey; });
+	if (!Result)
+	{
+		Result = &Cache->Results.AddDefaulted_GetRef();
+		Result->Viewer = ViewerKey;
+	}
+
+	Result->ViewerLocation = Request.Start;
+	Result->TargetLocation = Request.End;
+	Result->Time = GetWorld()->GetTimeSeconds();
+	Result->bVisible = !BlockingHit || BlockingHit->GetActor() == Target;
+}
+
+void UAILineOfSightSubsystem::PruneExpiredResults(double Now)
+{
+	for (auto It = TargetCaches.CreateIterator(); It; ++It)
+	{
+		FAILOSTargetCache& Cache = It.Value();
+		Cache.Results.RemoveAllSwap([&](const FAILOSSample& Sample) { return Now - Sample.Time > MaxResultAge; });
+
+		if (Cache.Results.Num() == 0 && Cache.Pending.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,121 @@
+// AI Line Of Sight Subsystem - Batched asynchronous visibility checks with cached results
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "UObject/ObjectKey.h"
+#include "AILineOfSightSubsystem.generated.h"
+
+/**
+ * Visibility result (or in-flight trace) from one viewer position to one target position
+ */
+struct FAILOSSample
+{
+	TObjectKey<AActor> Viewer;
+	FVector ViewerLocation = FVector::ZeroVector;
+	FVector TargetLocation = FVector::ZeroVector;
+	double Time = 0.0;
+	uint32 RequestId = 0;
+	bool bVisible = false;
+};
+
+/**
+ * Everything known about visibility of a single target
+ */
+struct FAILOSTargetCache
+{
+	// Completed results, at most one per viewer
+	TArray<FAILOSSample> Results;
+
+	// Traces queued or in flight this target is waiting on
+	TArray<FAILOSSample> Pending;
+};
+
+/**
+ * A visibility trace waiting to be dispatched or completed
+ */
+struct FAILOSRequest
+{
+	uint32 RequestId = 0;
+	TWeakObjectPtr<AActor> Viewer;
+	TWeakObjectPtr<AActor> Target;
+	TObjectKey<AActor> TargetKey;
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+};
+
+/**
+ * Line-of-sight service for AI.
+ * Queries return the last known result immediately. Missing or stale results queue a trace that is
+ * dispatched with other requests as AsyncLineTraceByChannel on the next tick. Agents looking at the
+ * same target from nearly the same place share results and in-flight traces.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UAILineOfSightSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ============================================
+	// Configuration
+	// ============================================
+
+	// Seconds a result is used before a refresh trace is requested
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Line Of Sight")
+	float StalenessWindow = 0.2f;
+
+	// Seconds after which an unrefreshed result is discarded
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Line Of Sight")
+	float MaxResultAge = 1.0f;
+
+	// Viewer and target may each have moved this far and still reuse a result
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Line Of Sight")
+	float SpatialTolerance = 100.0f;
+
+	// Async traces dispatched per frame, the rest wait for the next frame
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Line Of Sight")
+	int32 MaxTracesPerFrame = 64;
+
+	// ============================================
+	// Queries
+	// ============================================
+
+	// Last known visibility of Target from Viewer. False until the first trace completes.
+	UFUNCTION(BlueprintCallable, Category = "AI Line Of Sight")
+	bool HasLineOfSight(AActor* Viewer, AActor* Target);
+
+	UFUNCTION(BlueprintCallable, Category = "AI Line Of Sight")
+	int32 GetNumPendingTraces() const { return QueuedRequests.Num() + InFlightRequests.Num(); }
+
+	// Traces dispatched since the subsystem started
+	UFUNCTION(BlueprintCallable, Category = "AI Line Of Sight")
+	int32 GetNumTracesDispatched() const { return NumTracesDispatched; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	TMap<TObjectKey<AActor>, FAILOSTargetCache> TargetCaches;
+	TArray<FAILOSRequest> QueuedRequests;
+	TMap<uint32, FAILOSRequest> InFlightRequests;
+
+	FTraceDelegate TraceDelegate;
+	uint32 NextRequestId = 1;
+	int32 NumTracesDispatched = 0;
+
+	bool IsWithinTolerance(const FAILOSSample& Sample, const FVector& ViewerLocation, const FVector& TargetLocation) const;
+	void QueueRequest(FAILOSTargetCache& Cache, AActor* Viewer, AActor* Target, const FVector& ViewerLocation, const FVector& TargetLocation);
+	void DispatchQueuedRequests();
+	void PruneExpiredResults(double Now);
+	void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+};
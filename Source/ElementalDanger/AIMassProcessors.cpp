@@ -0,0 +1,378 @@
+// AI Mass Processors Implementation
+
+#include "AIMassProcessors.h"
+#include "AIMassTypes.h"
+#include "AIMassSubsystem.h"
+#include "VegetationSubsystem.h"
+#include "MassCommonFragments.h"
+#include "MassExecutionContext.h"
+
+namespace
+{
+	// Same acceptance radius the components pass to MoveToLocation
+	constexpr float MoveAcceptanceRadius = 50.0f;
+
+	bool FindPlayerInRadius(const TArray<FVector>& PlayerLocations, const FVector& Location, float Radius, FVector& OutPlayerLocation)
+	{
+		float NearestDistanceSq = FMath::Square(Radius);
+		bool bFound = false;
+
+		for (const FVector& PlayerLocation : PlayerLocations)
+		{
+			const float DistanceSq = FVector::DistSquared(Location, PlayerLocation);
+			if (DistanceSq <= NearestDistanceSq)
+			{
+				NearestDistanceSq = DistanceSq;
+				OutPlayerLocation = PlayerLocation;
+				bFound = true;
+			}
+		}
+
+		return bFound;
+	}
+
+	// Matches UAIBehaviorComponent::GetRandomLocationInRadius
+	FVector GetRandomLocationInRadius(const FVector& Origin, float Radius)
+	{
+		FVector RandomDirection = FMath::VRand();
+		RandomDirection.Z = 0;
+		RandomDirection.Normalize();
+
+		return Origin + (RandomDirection * FMath::RandRange(0.0f, Radius));
+	}
+
+	void SetMoveTarget(FAIMassBehaviorFragment& Behavior, const FVector& Target, float Speed)
+	{
+		Behavior.MoveTarget = Target;
+		Behavior.MoveSpeed = Speed;
+		Behavior.bHasMoveTarget = true;
+	}
+}
+
+// ============================================
+// Passive
+// ============================================
+
+UAIMassPassiveProcessor::UAIMassPassiveProcessor()
+	: EntityQuery(*this)
+{
+	// Executed by UAIMassSubsystem rather than the Mass processing phases
+	bAutoRegisterWithProcessingPhases = false;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+
+	// Queries the vegetation registry
+	bRequiresGameThreadExecution = true;
+}
+
+void UAIMassPassiveProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FAIMassBehaviorFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FAIMassFleeFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddConstSharedRequirement<FAIMassSettingsFragment>();
+	EntityQuery.AddTagRequirement<FAIMassPassiveTag>(EMassFragmentPresence::All);
+}
+
+void UAIMassPassiveProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	const UWorld* World = Context.GetWorld();
+	const UAIMassSubsystem* MassSubsystem = World ? World->GetSubsystem<UAIMassSubsystem>() : nullptr;
+	if (!MassSubsystem) return;
+
+	const UVegetationSubsystem* VegetationSubsystem = World->GetSubsystem<UVegetationSubsystem>();
+	const TArray<FVector>& PlayerLocations = MassSubsystem->GetPlayerLocations();
+	TArray<AActor*> FoundVegetation;
+
+	EntityQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext& ChunkContext)
+	{
+		const FAIMassSettingsFragment& Settings = ChunkContext.GetConstSharedFragment<FAIMassSettingsFragment>();
+		const FPassiveBehaviorSettings& Passive = Settings.PassiveSettings;
+		const TConstArrayView<FTransformFragment> Transforms = ChunkContext.GetFragmentView<FTransformFragment>();
+		const TArrayView<FAIMassBehaviorFragment> Behaviors = ChunkContext.GetMutableFragmentView<FAIMassBehaviorFragment>();
+		const TArrayView<FAIMassFleeFragment> Flees = ChunkContext.GetMutableFragmentView<FAIMassFleeFragment>();
+		const float DeltaTime = ChunkContext.GetDeltaTimeSeconds();
+
+		for (int32 EntityIndex = 0; EntityIndex < ChunkContext.GetNumEntities(); ++EntityIndex)
+		{
+			const FVector Location = Transforms[EntityIndex].GetTransform().GetLocation();
+			FAIMassBehaviorFragment& Behavior = Behaviors[EntityIndex];
+			FAIMassFleeFragment& Flee = Flees[EntityIndex];
+
+			Behavior.TimeSinceLastMeal += DeltaTime;
+
+			// Check for threats if can flee
+			FVector ThreatLocation;
+			if (Passive.bCanFlee && FindPlayerInRadius(PlayerLocations, Location, Passive.FleeDistance, ThreatLocation))
+			{
+				SetMoveTarget(Behavior, Location + (Location - ThreatLocation).GetSafeNormal2D() * Passive.FleeDistance, Settings.WalkSpeed);
+				Behavior.bHeadingToFood = false;
+				Behavior.State = EAIState::Fleeing;
+				Flee.bIsFleeing = true;
+				Flee.ThreatLocation = ThreatLocation;
+				continue;
+			}
+
+			switch (Behavior.State)
+			{
+				case EAIState::Idle:
+					Behavior.TimeSinceLastWander += DeltaTime;
+					if (Behavior.TimeSinceLastWander >= Passive.WanderInterval)
+					{
+						// Hungry mobs head for food instead of wandering
+						FoundVegetation.Reset();
+						if (VegetationSubsystem && Behavior.TimeSinceLastMeal >= Passive.EatingInterval)
+						{
+							VegetationSubsystem->FindNearestVegetation(Location, Passive.PreferredVegetationTags, 1,
+								Passive.VegetationSearchRadius, true, FoundVegetation);
+						}
+
+						Behavior.bHeadingToFood = FoundVegetation.Num() > 0;
+						const FVector Target = Behavior.bHeadingToFood ? FoundVegetation[0]->GetActorLocation() :
+							GetRandomLocationInRadius(Behavior.HomeLocation, Passive.WanderRadius);
+
+						SetMoveTarget(Behavior, Target, Settings.WalkSpeed);
+						Behavior.State = EAIState::Wandering;
+						Behavior.TimeSinceLastWander = 0.0f;
+					}
+					break;
+
+				case EAIState::Wandering:
+					// The movement processor clears the target on arrival
+					if (!Behavior.bHasMoveTarget)
+					{
+						Behavior.State = Behavior.bHeadingToFood ? EAIState::Eating : EAIState::Idle;
+						Behavior.bHeadingToFood = false;
+					}
+					break;
+
+				case EAIState::Eating:
+					Behavior.TimeSinceLastEat += DeltaTime;
+					if (Behavior.TimeSinceLastEat >= 5.0f) // Eat for 5 seconds
+					{
+						Behavior.State = EAIState::Idle;
+						Behavior.TimeSinceLastEat = 0.0f;
+						Behavior.TimeSinceLastMeal = 0.0f;
+					}
+					break;
+
+				case EAIState::Fleeing:
+					// Calm down once the flee point is reached and nobody followed
+					if (!Behavior.bHasMoveTarget)
+					{
+						Behavior.State = EAIState::Idle;
+						Flee.bIsFleeing = false;
+					}
+					break;
+
+				default:
+					break;
+			}
+		}
+	});
+}
+
+// ============================================
+// Chasing
+// ============================================
+
+UAIMassChasingProcessor::UAIMassChasingProcessor()
+	: EntityQuery(*this)
+{
+	bAutoRegisterWithProcessingPhases = false;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+}
+
+void UAIMassChasingProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddRequirement<FAIMassBehaviorFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FAIMassStaminaFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FAIMassFleeFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddConstSharedRequirement<FAIMassSettingsFragment>();
+	EntityQuery.AddTagRequirement<FAIMassChasingTag>(EMassFragmentPresence::All);
+}
+
+void UAIMassChasingProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	const UWorld* World = Context.GetWorld();
+	const UAIMassSubsystem* MassSubsystem = World ? World->GetSubsystem<UAIMassSubsystem>() : nullptr;
+	if (!MassSubsystem) return;
+
+	const TArray<FVector>& PlayerLocations = MassSubsystem->GetPlayerLocations();
+
+	EntityQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext& ChunkContext)
+	{
+		const FAIMassSettingsFragment& Settings = ChunkContext.GetConstSharedFragment<FAIMassSettingsFragment>();
+		const FChasingBehaviorSettings& Chasing = Settings.ChasingSettings;
+		const TConstArrayView<FTransformFragment> Transforms = ChunkContext.GetFragmentView<FTransformFragment>();
+		const TArrayView<FAIMassBehaviorFragment> Behaviors = ChunkContext.GetMutableFragmentView<FAIMassBehaviorFragment>();
+		const TArrayView<FAIMassStaminaFragment> Staminas = ChunkContext.GetMutableFragmentView<FAIMassStaminaFragment>();
+		const TArrayView<FAIMassFleeFragment> Flees = ChunkContext.GetMutableFragmentView<FAIMassFleeFragment>();
+		const float DeltaTime = ChunkContext.GetDeltaTimeSeconds();
+
+		for (int32 EntityIndex = 0; EntityIndex < ChunkContext.GetNumEntities(); ++EntityIndex)
+		{
+			const FVector Location = Transforms[EntityIndex].GetTransform().GetLocation();
+			FAIMassBehaviorFragment& Behavior = Behaviors[EntityIndex];
+			FAIMassStaminaFragment& Stamina = Staminas[EntityIndex];
+			FAIMassFleeFragment& Flee = Flees[EntityIndex];
+
+			FVector PlayerLocation;
+			if (FindPlayerInRadius(PlayerLocations, Location, Chasing.DetectionRadius, PlayerLocation))
+			{
+				if (!Stamina.bIsExhausted)
+				{
+					SetMoveTarget(Behavior, Location + (Location - PlayerLocation).GetSafeNormal2D() * 500.0f, Chasing.FleeSpeed);
+					Behavior.State = EAIState::Fleeing;
+					Flee.bIsFleeing = true;
+					Flee.ThreatLocation = PlayerLocation;
+
+					Stamina.CurrentStamina = FMath::Max(Stamina.CurrentStamina - (Chasing.StaminaDrainRate * DeltaTime), 0.0f);
+					if (Stamina.CurrentStamina <= 0.0f)
+					{
+						Stamina.bIsExhausted = true;
+					}
+				}
+				else
+				{
+					// Too exhausted to run
+					Behavior.bHasMoveTarget = false;
+					Behavior.State = EAIState::Idle;
+					Flee.bIsFleeing = false;
+				}
+			}
+			else
+			{
+				// Arrived at the flee or wander point
+				if ((Behavior.State == EAIState::Fleeing || Behavior.State == EAIState::Wandering) && !Behavior.bHasMoveTarget)
+				{
+					Behavior.State = EAIState::Idle;
+					Flee.bIsFleeing = false;
+				}
+
+				// Wander when no player nearby
+				if (Behavior.State == EAIState::Idle)
+				{
+					Behavior.TimeSinceLastWander += DeltaTime;
+					if (Behavior.TimeSinceLastWander >= 3.0f)
+					{
+						SetMoveTarget(Behavior, GetRandomLocationInRadius(Behavior.HomeLocation, Settings.PassiveSettings.WanderRadius), Settings.WalkSpeed);
+						Behavior.State = EAIState::Wandering;
+						Behavior.TimeSinceLastWander = 0.0f;
+					}
+				}
+			}
+
+			// Restore stamina when not fleeing
+			if (Behavior.State != EAIState::Fleeing && Stamina.CurrentStamina < Chasing.MaxStamina)
+			{
+				Stamina.CurrentStamina = FMath::Min(Stamina.CurrentStamina + (DeltaTime * 5.0f), Chasing.MaxStamina);
+				if (Stamina.CurrentStamina >= Chasing.MaxStamina * 0.5f)
+				{
+					Stamina.bIsExhausted = false;
+				}
+			}
+		}
+	});
+}
+
+// ============================================
+// Movement
+// ============================================
+
+UAIMassMovementProcessor::UAIMassMovementProcessor()
+	: EntityQuery(*this)
+{
+	bAutoRegisterWithProcessingPhases = false;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+}
+
+void UAIMassMovementProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FAIMassBehaviorFragment>(EMassFragmentAccess::ReadWrite);
+}
+
+void UAIMassMovementProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	EntityQuery.ForEachEntityChunk(Context, [](FMassExecutionContext& ChunkContext)
+	{
+		const TArrayView<FTransformFragment> Transforms = ChunkContext.GetMutableFragmentView<FTransformFragment>();
+		const TArrayView<FAIMassBehaviorFragment> Behaviors = ChunkContext.GetMutableFragmentView<FAIMassBehaviorFragment>();
+		const float DeltaTime = ChunkContext.GetDeltaTimeSeconds();
+
+		for (int32 EntityIndex = 0; EntityIndex < ChunkContext.GetNumEntities(); ++EntityIndex)
+		{
+			FAIMassBehaviorFragment& Behavior = Behaviors[EntityIndex];
+			if (!Behavior.bHasMoveTarget) continue;
+
+			FTransform& Transform = Transforms[EntityIndex].GetMutableTransform();
+			FVector Location = Transform.GetLocation();
+
+			// Height is resolved against the ground when the actor is materialized
+			FVector ToTarget = Behavior.MoveTarget - Location;
+			ToTarget.Z = 0.0f;
+			const float Distance = ToTarget.Size();
+			const float Step = Behavior.MoveSpeed * DeltaTime;
+
+			if (Distance <= MoveAcceptanceRadius + Step)
+			{
+				Location.X = Behavior.MoveTarget.X;
+				Location.Y = Behavior.MoveTarget.Y;
+				Behavior.bHasMoveTarget = false;
+			}
+			else
+			{
+				Location += (ToTarget / Distance) * Step;
+			}
+
+			Transform.SetLocation(Location);
+			if (Distance > KINDA_SMALL_NUMBER)
+			{
+				Transform.SetRotation(ToTarget.ToOrientationQuat());
+			}
+		}
+	});
+}
+
+// ============================================
+// Representation
+// ============================================
+
+UAIMassRepresentationProcessor::UAIMassRepresentationProcessor()
+	: EntityQuery(*this)
+{
+	bAutoRegisterWithProcessingPhases = false;
+	ExecutionFlags = static_cast<int32>(EProcessorExecutionFlags::All);
+	bRequiresGameThreadExecution = true;
+}
+
+void UAIMassRepresentationProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+	EntityQuery.AddConstSharedRequirement<FAIMassSettingsFragment>();
+}
+
+void UAIMassRepresentationProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	const UWorld* World = Context.GetWorld();
+	UAIMassSubsystem* MassSubsystem = World ? World->GetSubsystem<UAIMassSubsystem>() : nullptr;
+	if (!MassSubsystem || MassSubsystem->GetPlayerLocations().Num() == 0) return;
+
+	const TArray<FVector>& PlayerLocations = MassSubsystem->GetPlayerLocations();
+	const float MaterializeRadius = MassSubsystem->MaterializeRadius;
+
+	EntityQuery.ForEachEntityChunk(Context, [&](FMassExecutionContext& ChunkContext)
+	{
+		const TConstArrayView<FTransformFragment> Transforms = ChunkContext.GetFragmentView<FTransformFragment>();
+
+		for (int32 EntityIndex = 0; EntityIndex < ChunkContext.GetNumEntities(); ++EntityIndex)
+		{
+			FVector PlayerLocation;
+			if (FindPlayerInRadius(PlayerLocations, Transforms[EntityIndex].GetTransform().GetLocation(), MaterializeRadius, PlayerLocation))
+			{
+				MassSubsystem->QueueMaterialization(ChunkContext.GetEntity(EntityIndex));
+			}
+		}
+	});
+}
@@ -0,0 +1,83 @@
+// AI Mass Processors - Passive and Chasing behavior ported to Mass entities
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "AIMassProcessors.generated.h"
+
+/**
+ * Port of UAIBehaviorComponent::UpdatePassiveBehavior.
+ * Grazing uses the vegetation registry without reservations, entities never stand on a bush long
+ * enough for the herd to pile up.
+ */
+UCLASS()
+class ELEMENTALDANGER_API UAIMassPassiveProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UAIMassPassiveProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery EntityQuery;
+};
+
+/**
+ * Port of UAIBehaviorComponent::UpdateChasingBehavior.
+ * Catching needs an actor, so entities are always materialized before a player gets that close.
+ */
+UCLASS()
+class ELEMENTALDANGER_API UAIMassChasingProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UAIMassChasingProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery EntityQuery;
+};
+
+/**
+ * Straight-line movement towards the move target, standing in for CharacterMovement and pathing
+ */
+UCLASS()
+class ELEMENTALDANGER_API UAIMassMovementProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UAIMassMovementProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery EntityQuery;
+};
+
+/**
+ * Collects entities a player has come close enough to that they need an actor
+ */
+UCLASS()
+class ELEMENTALDANGER_API UAIMassRepresentationProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UAIMassRepresentationProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+	FMassEntityQuery EntityQuery;
+};
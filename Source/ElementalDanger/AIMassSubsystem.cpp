@@ -0,0 +1,392 @@
+// AI Mass Subsystem Implementation
+
+#include "AIMassSubsystem.h"
+#include "AIMassTypes.h"
+#include "AIMassProcessors.h"
+#include "AIBehaviorComponent.h"
+#include "CombatEntity.h"
+#include "MassEntitySubsystem.h"
+#include "MassEntityManager.h"
+#include "MassExecutor.h"
+#include "MassProcessingTypes.h"
+#include "MassCommonFragments.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "NavigationSystem.h"
+
+namespace
+{
+	// How far above and below an entity to look for ground when materializing
+	constexpr float GroundTraceHeight = 2000.0f;
+}
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UAIMassSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAIMassSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UMassEntitySubsystem* EntitySubsystem = Collection.InitializeDependency<UMassEntitySubsystem>();
+	if (!EntitySubsystem) return;
+
+	EntityManager = EntitySubsystem->GetMutableEntityManager().AsShared();
+
+	CreateArchetypes();
+	CreateProcessors();
+}
+
+void UAIMassSubsystem::Deinitialize()
+{
+	SimulationProcessors.Empty();
+	RepresentationProcessor = nullptr;
+	Representables.Empty();
+	PendingMaterializations.Empty();
+	PlayerLocations.Empty();
+	EntityManager.Reset();
+	NumEntities = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UAIMassSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAIMassSubsystem, STATGROUP_Tickables);
+}
+
+void UAIMassSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!EntityManager.IsValid()) return;
+
+	GatherPlayerLocations();
+
+	if (NumEntities > 0)
+	{
+		FMassProcessingContext ProcessingContext(EntityManager.ToSharedRef(), DeltaTime);
+		UE::Mass::Executor::RunProcessorsView(MakeArrayView(SimulationProcessors), ProcessingContext);
+	}
+
+	TimeSinceRepresentationCheck += DeltaTime;
+	if (TimeSinceRepresentationCheck < RepresentationCheckInterval || PlayerLocations.Num() == 0) return;
+	TimeSinceRepresentationCheck = 0.0f;
+
+	if (NumEntities > 0 && RepresentationProcessor)
+	{
+		FMassProcessingContext ProcessingContext(EntityManager.ToSharedRef(), DeltaTime);
+		UE::Mass::Executor::Run(*RepresentationProcessor, ProcessingContext);
+	}
+
+	// Entities past the budget are found again on the next check
+	const int32 NumToMaterialize = FMath::Min(PendingMaterializations.Num(), MaxMaterializationsPerCheck);
+	for (int32 Index = 0; Index < NumToMaterialize; ++Index)
+	{
+		MaterializeEntity(PendingMaterializations[Index]);
+	}
+	PendingMaterializations.Reset();
+
+	DematerializeDistantAgents();
+}
+
+void UAIMassSubsystem::CreateArchetypes()
+{
+	TArray<const UScriptStruct*> Composition =
+	{
+		FTransformFragment::StaticStruct(),
+		FAIMassBehaviorFragment::StaticStruct(),
+		FAIMassFleeFragment::StaticStruct(),
+		FAIMassPassiveTag::StaticStruct()
+	};
+	PassiveArchetype = EntityManager->CreateArchetype(Composition);
+
+	Composition.Remove(FAIMassPassiveTag::StaticStruct());
+	Composition.Add(FAIMassStaminaFragment::StaticStruct());
+	Composition.Add(FAIMassChasingTag::StaticStruct());
+	ChasingArchetype = EntityManager->CreateArchetype(Composition);
+}
+
+void UAIMassSubsystem::CreateProcessors()
+{
+	// Behavior decides where to go, movement then moves there in the same tick
+	for (UClass* ProcessorClass : { UAIMassPassiveProcessor::StaticClass(), UAIMassChasingProcessor::StaticClass(), UAIMassMovementProcessor::StaticClass() })
+	{
+		UMassProcessor* Processor = NewObject<UMassProcessor>(this, ProcessorClass);
+		Processor->CallInitialize(this, EntityManager.ToSharedRef());
+		SimulationProcessors.Add(Processor);
+	}
+
+	RepresentationProcessor = NewObject<UAIMassRepresentationProcessor>(this);
+	RepresentationProcessor->CallInitialize(this, EntityManager.ToSharedRef());
+}
+
+void UAIMassSubsystem::GatherPlayerLocations()
+{
+	PlayerLocations.Reset();
+
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APawn* PlayerPawn = It->Get() ? It->Get()->GetPawn() : nullptr)
+		{
+			PlayerLocations.Add(PlayerPawn->GetActorLocation());
+		}
+	}
+}
+
+float UAIMassSubsystem::DistanceSqToNearestPlayer(const FVector& Location) const
+{
+	float NearestDistanceSq = TNumericLimits<float>::Max();
+	for (const FVector& PlayerLocation : PlayerLocations)
+	{
+		NearestDistanceSq = FMath::Min(NearestDistanceSq, static_cast<float>(FVector::DistSquared(Location, PlayerLocation)));
+	}
+
+	return NearestDistanceSq;
+}
+
+// ============================================
+// Entities
+// ============================================
+
+bool UAIMassSubsystem::SupportsBehaviorType(EAIBehaviorType BehaviorType)
+{
+	return BehaviorType == EAIBehaviorType::Passive || BehaviorType == EAIBehaviorType::Chasing;
+}
+
+int32 UAIMassSubsystem::SpawnAmbientMobs(TSubclassOf<ACombatEntity> ActorClass, FVector Center, float Radius, int32 Count)
+{
+	if (!EntityManager.IsValid() || !ActorClass || Count <= 0) return 0;
+
+	const UAIBehaviorComponent* DefaultBehavior = AActor::GetActorClassDefaultComponent<UAIBehaviorComponent>(ActorClass);
+	if (!DefaultBehavior || !SupportsBehaviorType(DefaultBehavior->BehaviorType)) return 0;
+
+	FAIMassSettingsFragment Settings;
+	Settings.ActorClass = ActorClass;
+	Settings.BehaviorType = DefaultBehavior->BehaviorType;
+	Settings.PassiveSettings = DefaultBehavior->PassiveSettings;
+	Settings.ChasingSettings = DefaultBehavior->ChasingSettings;
+	Settings.WalkSpeed = ActorClass->GetDefaultObject<ACombatEntity>()->GetCharacterMovement()->MaxWalkSpeed;
+
+	UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		FVector Location = Center + FVector(FMath::RandPointInCircle(Radius), 0.0f);
+
+		FNavLocation NavLocation;
+		if (NavSystem && NavSystem->GetRandomPointInNavigableRadius(Center, Radius, NavLocation))
+		{
+			Location = NavLocation.Location;
+		}
+
+		CreateEntity(Settings, FTransform(FRotator(0.0f, FMath::FRandRange(0.0f, 360.0f), 0.0f), Location));
+	}
+
+	return Count;
+}
+
+FMassEntityHandle UAIMassSubsystem::CreateEntity(const FAIMassSettingsFragment& Settings, const FTransform& Transform)
+{
+	// Entities with identical settings share one fragment instance
+	FMassArchetypeSharedFragmentValues SharedValues;
+	SharedValues.Add(EntityManager->GetOrCreateConstSharedFragment(Settings));
+	SharedValues.Sort();
+
+	const bool bChasing = Settings.BehaviorType == EAIBehaviorType::Chasing;
+	const FMassEntityHandle Entity = EntityManager->CreateEntity(bChasing ? ChasingArchetype : PassiveArchetype, SharedValues);
+
+	EntityManager->GetFragmentDataChecked<FTransformFragment>(Entity).SetTransform(Transform);
+	EntityManager->GetFragmentDataChecked<FAIMassBehaviorFragment>(Entity).HomeLocation = Transform.GetLocation();
+	if (bChasing)
+	{
+		EntityManager->GetFragmentDataChecked<FAIMassStaminaFragment>(Entity).CurrentStamina = Settings.ChasingSettings.MaxStamina;
+	}
+
+	++NumEntities;
+	return Entity;
+}
+
+void UAIMassSubsystem::QueueMaterialization(FMassEntityHandle Entity)
+{
+	PendingMaterializations.Add(Entity);
+}
+
+bool UAIMassSubsystem::MaterializeEntity(FMassEntityHandle Entity)
+{
+	if (!EntityManager->IsEntityValid(Entity)) return false;
+
+	// Copied out, the entity is destroyed once its actor exists
+	const FAIMassSettingsFragment Settings = EntityManager->GetConstSharedFragmentDataChecked<FAIMassSettingsFragment>(Entity);
+	const FAIMassBehaviorFragment BehaviorFragment = EntityManager->GetFragmentDataChecked<FAIMassBehaviorFragment>(Entity);
+	const FAIMassStaminaFragment* StaminaFragment = EntityManager->GetFragmentDataPtr<FAIMassStaminaFragment>(Entity);
+	const FAIMassStaminaFragment Stamina = StaminaFragment ? *StaminaFragment : FAIMassStaminaFragment();
+	const FTransform Transform = EntityManager->GetFragmentDataChecked<FTransformFragment>(Entity).GetTransform();
+
+	if (!Settings.ActorClass)
+	{
+		EntityManager->DestroyEntity(Entity);
+		--NumEntities;
+		return false;
+	}
+
+	// Entities move on a flat plane, put the capsule back on the ground
+	UWorld* World = GetWorld();
+	FVector SpawnLocation = Transform.GetLocation();
+	FHitResult Hit;
+	if (World->LineTraceSingleByChannel(Hit, SpawnLocation + FVector(0.0f, 0.0f, GroundTraceHeight), SpawnLocation - FVector(0.0f, 0.0f, GroundTraceHeight), ECC_Visibility))
+	{
+		const ACombatEntity* DefaultEntity = Settings.ActorClass->GetDefaultObject<ACombatEntity>();
+		SpawnLocation.Z = Hit.ImpactPoint.Z + DefaultEntity->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	ACombatEntity* Actor = World->SpawnActor<ACombatEntity>(Settings.ActorClass, SpawnLocation, Transform.Rotator(), SpawnParams);
+	if (!Actor) return false;
+
+	EntityManager->DestroyEntity(Entity);
+	--NumEntities;
+
+	// Part of spawn setup, so assigned directly rather than reported to health observers
+	Actor->CurrentHealth = Actor->MaxHealth * BehaviorFragment.HealthFraction;
+
+	UAIBehaviorComponent* Behavior = Actor->FindComponentByClass<UAIBehaviorComponent>();
+	if (!Behavior) return true;
+
+	Behavior->PassiveSettings = Settings.PassiveSettings;
+	Behavior->ChasingSettings = Settings.ChasingSettings;
+	Behavior->bAllowMassRepresentation = true;
+	RegisterRepresentable(Behavior);
+	if (Behavior->BehaviorType != Settings.BehaviorType)
+	{
+		Behavior->SetBehaviorType(Settings.BehaviorType);
+	}
+	else
+	{
+		Behavior->RefreshProximityRings();
+	}
+
+	Behavior->SpawnLocation = BehaviorFragment.HomeLocation;
+	Behavior->HotState->TimeSinceLastWander = BehaviorFragment.TimeSinceLastWander;
+	Behavior->HotState->TimeSinceLastMeal = BehaviorFragment.TimeSinceLastMeal;
+	Behavior->HotState->TimeSinceLastEat = BehaviorFragment.TimeSinceLastEat;
+	if (StaminaFragment)
+	{
+		Behavior->HotState->CurrentStamina = Stamina.CurrentStamina;
+		Behavior->HotState->bIsExhausted = Stamina.bIsExhausted;
+	}
+
+	// Resume the walk or meal, fleeing is re-evaluated against the real player
+	if (BehaviorFragment.State == EAIState::Wandering && BehaviorFragment.bHasMoveTarget)
+	{
+		Behavior->WanderTarget = BehaviorFragment.MoveTarget;
+		Behavior->MoveToLocation(BehaviorFragment.MoveTarget);
+		Behavior->SetStateWithReason(EAIState::Wandering, TEXT("Materialized"));
+	}
+	else if (BehaviorFragment.State == EAIState::Eating)
+	{
+		Behavior->SetStateWithReason(EAIState::Eating, TEXT("Materialized"));
+	}
+
+	return true;
+}
+
+// ============================================
+// Actors
+// ============================================
+
+void UAIMassSubsystem::RegisterRepresentable(UAIBehaviorComponent* Behavior)
+{
+	if (Behavior)
+	{
+		Representables.AddUnique(Behavior);
+	}
+}
+
+void UAIMassSubsystem::UnregisterRepresentable(UAIBehaviorComponent* Behavior)
+{
+	Representables.RemoveSingleSwap(Behavior, EAllowShrinking::No);
+}
+
+bool UAIMassSubsystem::DematerializeAgent(UAIBehaviorComponent* Behavior)
+{
+	ACombatEntity* Owner = Behavior ? Behavior->OwnerEntity : nullptr;
+	if (!Owner || !EntityManager.IsValid() || !SupportsBehaviorType(Behavior->BehaviorType)) return false;
+
+	// Busy agents keep their actor
+	if (Behavior->HotState->bIsInCombat || Behavior->CurrentState == EAIState::Fleeing || Behavior->CurrentState == EAIState::Attacking)
+	{
+		return false;
+	}
+
+	FAIMassSettingsFragment Settings;
+	Settings.ActorClass = Owner->GetClass();
+	Settings.BehaviorType = Behavior->BehaviorType;
+	Settings.PassiveSettings = Behavior->PassiveSettings;
+	Settings.ChasingSettings = Behavior->ChasingSettings;
+
+	// The live speed may still be a flee speed
+	Settings.WalkSpeed = Owner->GetClass()->GetDefaultObject<ACombatEntity>()->GetCharacterMovement()->MaxWalkSpeed;
+
+	const FMassEntityHandle Entity = CreateEntity(Settings, Owner->GetActorTransform());
+
+	FAIMassBehaviorFragment& BehaviorFragment = EntityManager->GetFragmentDataChecked<FAIMassBehaviorFragment>(Entity);
+	BehaviorFragment.HomeLocation = Behavior->SpawnLocation;
+	BehaviorFragment.TimeSinceLastWander = Behavior->HotState->TimeSinceLastWander;
+	BehaviorFragment.TimeSinceLastMeal = Behavior->HotState->TimeSinceLastMeal;
+	BehaviorFragment.TimeSinceLastEat = Behavior->HotState->TimeSinceLastEat;
+	BehaviorFragment.HealthFraction = Owner->GetHealthPercentage();
+
+	if (Behavior->CurrentState == EAIState::Wandering)
+	{
+		BehaviorFragment.State = EAIState::Wandering;
+		BehaviorFragment.MoveTarget = Behavior->WanderTarget;
+		BehaviorFragment.MoveSpeed = Settings.WalkSpeed;
+		BehaviorFragment.bHasMoveTarget = true;
+		BehaviorFragment.bHeadingToFood = Behavior->CurrentVegetation != nullptr;
+	}
+	else if (Behavior->CurrentState == EAIState::Eating)
+	{
+		BehaviorFragment.State = EAIState::Eating;
+	}
+
+	if (Settings.BehaviorType == EAIBehaviorType::Chasing)
+	{
+		FAIMassStaminaFragment& Stamina = EntityManager->GetFragmentDataChecked<FAIMassStaminaFragment>(Entity);
+		Stamina.CurrentStamina = Behavior->HotState->CurrentStamina;
+		Stamina.bIsExhausted = Behavior->HotState->bIsExhausted;
+	}
+
+	// EndPlay releases vegetation and unregisters from every subsystem
+	Owner->Destroy();
+	return true;
+}
+
+void UAIMassSubsystem::DematerializeDistantAgents()
+{
+	const float DematerializeDistanceSq = FMath::Square(MaterializeRadius + DematerializeHysteresis);
+	int32 NumDematerialized = 0;
+
+	// Destroying an actor unregisters it, so walk a copy
+	const TArray<UAIBehaviorComponent*> Candidates = Representables;
+	for (UAIBehaviorComponent* Behavior : Candidates)
+	{
+		if (NumDematerialized >= MaxDematerializationsPerCheck) break;
+
+		const AActor* Owner = IsValid(Behavior) ? Behavior->GetOwner() : nullptr;
+		if (!Owner || DistanceSqToNearestPlayer(Owner->GetActorLocation()) < DematerializeDistanceSq) continue;
+
+		if (DematerializeAgent(Behavior))
+		{
+			++NumDematerialized;
+		}
+	}
+}
@@ -0,0 +1,125 @@
+// AI Mass Subsystem - Runs ambient Passive/Chasing mobs as Mass entities and swaps actors in near players
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MassEntityTypes.h"
+#include "AIBehaviorTypes.h"
+#include "AIMassSubsystem.generated.h"
+
+class ACombatEntity;
+class UAIBehaviorComponent;
+class UMassProcessor;
+struct FMassEntityManager;
+struct FAIMassSettingsFragment;
+
+/**
+ * Ambient creatures far from every player live as Mass entities: a transform and a few behavior
+ * fragments instead of a character with movement, capsule and AI components. The passive and
+ * chasing processors port the component's state machines so the herd keeps wandering, grazing
+ * and fleeing while unseen.
+ *
+ * An entity within MaterializeRadius of a player is replaced by its actor, carrying its state
+ * over. Actors with bAllowMassRepresentation that drift beyond MaterializeRadius plus
+ * DematerializeHysteresis are folded back into entities.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UAIMassSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ============================================
+	// Configuration
+	// ============================================
+
+	// Entities this close to a player become actors
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Mass")
+	float MaterializeRadius = 6000.0f;
+
+	// Extra distance before an actor turns back into an entity
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Mass")
+	float DematerializeHysteresis = 1000.0f;
+
+	// Seconds between materialize/dematerialize checks
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Mass")
+	float RepresentationCheckInterval = 0.5f;
+
+	// Caps on actor spawns and destroys per check, the rest wait for the next one
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Mass")
+	int32 MaxMaterializationsPerCheck = 8;
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Mass")
+	int32 MaxDematerializationsPerCheck = 16;
+
+	// ============================================
+	// Entities
+	// ============================================
+
+	/**
+	 * Spawns Count entities of ActorClass around Center. Behavior settings come from the
+	 * class's default UAIBehaviorComponent, which must be Passive or Chasing.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "AI Mass")
+	int32 SpawnAmbientMobs(TSubclassOf<ACombatEntity> ActorClass, FVector Center, float Radius, int32 Count);
+
+	// Replaces the agent's actor with an entity, false if it is busy or not a supported type
+	bool DematerializeAgent(UAIBehaviorComponent* Behavior);
+
+	// Actors eligible to fold back into entities when far from players
+	void RegisterRepresentable(UAIBehaviorComponent* Behavior);
+	void UnregisterRepresentable(UAIBehaviorComponent* Behavior);
+
+	static bool SupportsBehaviorType(EAIBehaviorType BehaviorType);
+
+	UFUNCTION(BlueprintCallable, Category = "AI Mass")
+	int32 GetNumEntities() const { return NumEntities; }
+
+	// Read by the processors
+	const TArray<FVector>& GetPlayerLocations() const { return PlayerLocations; }
+	void QueueMaterialization(FMassEntityHandle Entity);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	TSharedPtr<FMassEntityManager> EntityManager;
+
+	FMassArchetypeHandle PassiveArchetype;
+	FMassArchetypeHandle ChasingArchetype;
+
+	// Behavior and movement, run every tick in this order
+	UPROPERTY()
+	TArray<UMassProcessor*> SimulationProcessors;
+
+	UPROPERTY()
+	UMassProcessor* RepresentationProcessor;
+
+	UPROPERTY()
+	TArray<UAIBehaviorComponent*> Representables;
+
+	TArray<FVector> PlayerLocations;
+	TArray<FMassEntityHandle> PendingMaterializations;
+
+	int32 NumEntities = 0;
+	float TimeSinceRepresentationCheck = 0.0f;
+
+	void CreateArchetypes();
+	void CreateProcessors();
+	void GatherPlayerLocations();
+
+	FMassEntityHandle CreateEntity(const FAIMassSettingsFragment& Settings, const FTransform& Transform);
+	bool MaterializeEntity(FMassEntityHandle Entity);
+	void DematerializeDistantAgents();
+
+	float DistanceSqToNearestPlayer(const FVector& Location) const;
+};
@@ -0,0 +1,101 @@
+// AI Mass Types - Fragments and tags for ambient mobs simulated as Mass entities
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "AIBehaviorTypes.h"
+#include "AIMassTypes.generated.h"
+
+class ACombatEntity;
+
+// ============================================
+// Fragments
+// ============================================
+
+/**
+ * Behavior state machine of an ambient entity, mirrors the component's state and hot state
+ */
+USTRUCT()
+struct FAIMassBehaviorFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	EAIState State = EAIState::Idle;
+
+	FVector HomeLocation = FVector::ZeroVector;
+	FVector MoveTarget = FVector::ZeroVector;
+	bool bHasMoveTarget = false;
+	float MoveSpeed = 0.0f;
+
+	// The move target is vegetation, arriving starts eating
+	bool bHeadingToFood = false;
+
+	float TimeSinceLastWander = 0.0f;
+	float TimeSinceLastMeal = 0.0f;
+	float TimeSinceLastEat = 0.0f;
+
+	// Health of the actor when it was dematerialized, restored on the respawned actor
+	float HealthFraction = 1.0f;
+};
+
+/**
+ * Chasing critters tire while running from players
+ */
+USTRUCT()
+struct FAIMassStaminaFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	float CurrentStamina = 100.0f;
+	bool bIsExhausted = false;
+};
+
+USTRUCT()
+struct FAIMassFleeFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	bool bIsFleeing = false;
+	FVector ThreatLocation = FVector::ZeroVector;
+};
+
+/**
+ * Settings shared by every entity materializing into the same actor class with the same tuning
+ */
+USTRUCT()
+struct FAIMassSettingsFragment : public FMassConstSharedFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<ACombatEntity> ActorClass;
+
+	UPROPERTY()
+	EAIBehaviorType BehaviorType = EAIBehaviorType::Passive;
+
+	UPROPERTY()
+	FPassiveBehaviorSettings PassiveSettings;
+
+	UPROPERTY()
+	FChasingBehaviorSettings ChasingSettings;
+
+	UPROPERTY()
+	float WalkSpeed = 300.0f;
+};
+
+// ============================================
+// Tags
+// ============================================
+
+USTRUCT()
+struct FAIMassPassiveTag : public FMassTag
+{
+	GENERATED_BODY()
+};
+
+USTRUCT()
+struct FAIMassChasingTag : public FMassTag
+{
+	GENERATED_BODY()
+};
@@ -0,0 +1,242 @@
+// AI Navigation Subsystem Implementation
+
+#include "AINavigationSubsystem.h"
+#include "AIController.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "Navigation/PathFollowingComponent.h"
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UAINavigationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAINavigationSubsystem::Deinitialize()
+{
+	Agents.Empty();
+	PendingAgents.Empty();
+	PathCache.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UAINavigationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAINavigationSubsystem, STATGROUP_Tickables);
+}
+
+void UAINavigationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FlushPendingMoves();
+
+	StatsWindowTime += DeltaTime;
+	if (StatsWindowTime >= 1.0f)
+	{
+		UpdateStats();
+		PruneCache();
+	}
+}
+
+// ============================================
+// Requests
+// ============================================
+
+EAINavRequestResult UAINavigationSubsystem::RequestMove(AAIController* Controller, const FVector& Goal, float AcceptanceRadius)
+{
+	if (!Controller || !Controller->GetPawn()) return EAINavRequestResult::Failed;
+
+	++NavigationStats.TotalRequests;
+
+	FAINavAgentState& Agent = Agents.FindOrAdd(Controller);
+	Agent.Controller = Controller;
+
+	const bool bMoving = Controller->GetMoveStatus() == EPathFollowingStatus::Moving;
+
+	// Still heading to practically the same place
+	if (bMoving && FVector::DistSquared(Goal, Agent.LastGoal) <= FMath::Square(GoalTolerance))
+	{
+		Agent.bHasPendingGoal = false;
+		PendingAgents.Remove(Controller);
+		++NumMerged;
+		return EAINavRequestResult::Merged;
+	}
+
+	// Repathed too recently, the newest goal goes out once the interval is up
+	if (bMoving && GetWorld()->GetTimeSeconds() - Agent.LastRequestTime < MinRepathInterval)
+	{
+		Agent.bHasPendingGoal = true;
+		Agent.PendingGoal = Goal;
+		Agent.PendingAcceptanceRadius = AcceptanceRadius;
+		PendingAgents.Add(Controller);
+		++NumDeferred;
+		return EAINavRequestResult::Deferred;
+	}
+
+	Agent.bHasPendingGoal = false;
+	PendingAgents.Remove(Controller);
+	return IssueMove(Controller, Agent, Goal, AcceptanceRadius) ? EAINavRequestResult::Issued : EAINavRequestResult::Failed;
+}
+
+void UAINavigationSubsystem::CancelMove(AAIController* Controller)
+{
+	if (!Controller) return;
+
+	if (FAINavAgentState* Agent = Agents.Find(Controller))
+	{
+		Agent->bHasPendingGoal = false;
+	}
+	PendingAgents.Remove(Controller);
+
+	Controller->StopMovement();
+}
+
+bool UAINavigationSubsystem::IssueMove(AAIController* Controller, FAINavAgentState& Agent, const FVector& Goal, float AcceptanceRadius)
+{
+	UWorld* World = GetWorld();
+	UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	if (!NavSystem || !Controller->GetPawn()) return false;
+
+	FAIMoveRequest MoveRequest(Goal);
+	MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
+
+	const double Now = World->GetTimeSeconds();
+	const FVector Start = Controller->GetNavAgentLocation();
+	const TPair<FIntVector, FIntVector> CacheKey(GetCell(Start), GetCell(Goal));
+
+	FNavPathSharedPtr Path;
+
+	// Endpoints are projected like a pathfinding query would, a goal that can't be projected is
+	// left to the full query
+	const FAICachedPath* CachedPath = PathCache.Find(CacheKey);
+	FNavLocation ProjectedStart;
+	FNavLocation ProjectedGoal;
+	if (CachedPath && CachedPath->NavData.IsValid() && Now - CachedPath->FoundTime <= PathCacheLifetime &&
+		NavSystem->ProjectPointToNavigation(Start, ProjectedStart, INVALID_NAVEXTENT, CachedPath->NavData.Get()) &&
+		NavSystem->ProjectPointToNavigation(Goal, ProjectedGoal, INVALID_NAVEXTENT, CachedPath->NavData.Get()))
+	{
+		// Same corridor, with this agent's own endpoints
+		TArray<FVector> Points = CachedPath->Points;
+		Points[0] = ProjectedStart.Location;
+		Points.Last() = ProjectedGoal.Location;
+
+		Path = MakeShared<FNavigationPath, ESPMode::ThreadSafe>(Points, nullptr);
+		Path->SetNavigationDataUsed(CachedPath->NavData.Get());
+		Path->MarkReady();
+		++NumCacheHits;
+	}
+	else
+	{
+		FPathFindingQuery Query;
+		if (!Controller->BuildPathfindingQuery(MoveRequest, Query)) return false;
+
+		const FPathFindingResult Result = NavSystem->FindPathSync(Query);
+		if (!Result.IsSuccessful() || !Result.Path.IsValid()) return false;
+
+		Path = Result.Path;
+		++NumPathfinds;
+		++NavigationStats.TotalPathfinds;
+
+		const TArray<FNavPathPoint>& PathPoints = Path->GetPathPoints();
+		if (PathPoints.Num() >= 2 && (PathCache.Num() < MaxCachedPaths || PathCache.Contains(CacheKey)))
+		{
+			FAICachedPath& Entry = PathCache.FindOrAdd(CacheKey);
+			Entry.Points.Reset(PathPoints.Num());
+			for (const FNavPathPoint& Point : PathPoints)
+			{
+				Entry.Points.Add(Point.Location);
+			}
+			Entry.NavData = Query.NavData;
+			Entry.FoundTime = Now;
+		}
+	}
+
+	if (!Controller->RequestMove(MoveRequest, Path).IsValid()) return false;
+
+	Agent.LastGoal = Goal;
+	Agent.LastRequestTime = Now;
+	++NumRepaths;
+	return true;
+}
+
+void UAINavigationSubsystem::FlushPendingMoves()
+{
+	if (PendingAgents.Num() == 0) return;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	for (auto It = PendingAgents.CreateIterator(); It; ++It)
+	{
+		FAINavAgentState* Agent = Agents.Find(*It);
+		AAIController* Controller = Agent ? Agent->Controller.Get() : nullptr;
+		if (!Controller || !Agent->bHasPendingGoal)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (Now - Agent->LastRequestTime < MinRepathInterval) continue;
+
+		Agent->bHasPendingGoal = false;
+		It.RemoveCurrent();
+		IssueMove(Controller, *Agent, Agent->PendingGoal, Agent->PendingAcceptanceRadius);
+	}
+}
+
+// ============================================
+// Cache and Stats
+// ============================================
+
+FIntVector UAINavigationSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X / PathCacheCellSize),
+		FMath::FloorToInt(Location.Y / PathCacheCellSize),
+		FMath::FloorToInt(Location.Z / PathCacheCellSize));
+}
+
+void UAINavigationSubsystem::PruneCache()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	for (auto It = PathCache.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value().FoundTime > PathCacheLifetime || !It.Value().NavData.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Controllers destroyed since they last moved
+	for (auto It = Agents.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Controller.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UAINavigationSubsystem::UpdateStats()
+{
+	const float InvWindow = 1.0f / StatsWindowTime;
+
+	NavigationStats.RepathsPerSecond = NumRepaths * InvWindow;
+	NavigationStats.PathfindsPerSecond = NumPathfinds * InvWindow;
+	NavigationStats.CacheHitsPerSecond = NumCacheHits * InvWindow;
+	NavigationStats.MergedPerSecond = NumMerged * InvWindow;
+	NavigationStats.DeferredPerSecond = NumDeferred * InvWindow;
+	NavigationStats.CachedPaths = PathCache.Num();
+
+	NumRepaths = 0;
+	NumPathfinds = 0;
+	NumCacheHits = 0;
+	NumMerged = 0;
+	NumDeferred = 0;
+	StatsWindowTime = 0.0f;
+}
@@ -0,0 +1,164 @@
+// AI Navigation Subsystem - Coalesces AI move requests and shares paths between nearby agents
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AINavigationSubsystem.generated.h"
+
+class AAIController;
+class ANavigationData;
+
+/**
+ * Move requests handled over the last stats window, per second
+ */
+USTRUCT(BlueprintType)
+struct FAINavigationStats
+{
+	GENERATED_BODY()
+
+	// Moves actually handed to path following
+	UPROPERTY(BlueprintReadOnly, Category = "AI Navigation")
+	float RepathsPerSecond = 0.0f;
+
+	// Repaths that had to run the pathfinder
+	UPROPERTY(BlueprintReadOnly, Category = "AI Navigation")
+	float PathfindsPerSecond = 0.0f;
+
+	// Repaths served from the path cache
+	UPROPERTY(BlueprintReadOnly, Category = "AI Navigation")
+	float CacheHitsPerSecond = 0.0f;
+
+	// Requests dropped because the goal barely moved
+	UPROPERTY(BlueprintReadOnly, Category = "AI Navigation")
+	float MergedPerSecond = 0.0f;
+
+	// Requests held back by the per-agent repath interval
+	UPROPERTY(BlueprintReadOnly, Category = "AI Navigation")
+	float DeferredPerSecond = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI Navigation")
+	int32 CachedPaths = 0;
+
+	// Since the subsystem started
+	UPROPERTY(BlueprintReadOnly, Category = "AI Navigation")
+	int32 TotalRequests = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI Navigation")
+	int32 TotalPathfinds = 0;
+};
+
+enum class EAINavRequestResult : uint8
+{
+	Issued,
+	Merged,
+	Deferred,
+	Failed
+};
+
+/**
+ * Last move issued for one controller, and the newest goal waiting for its repath interval
+ */
+struct FAINavAgentState
+{
+	TWeakObjectPtr<AAIController> Controller;
+
+	FVector LastGoal = FVector::ZeroVector;
+	double LastRequestTime = -UE_BIG_NUMBER;
+
+	bool bHasPendingGoal = false;
+	FVector PendingGoal = FVector::ZeroVector;
+	float PendingAcceptanceRadius = 0.0f;
+};
+
+/**
+ * Path points found for a start/goal cell pair, reused by agents moving between the same cells
+ */
+struct FAICachedPath
+{
+	TArray<FVector> Points;
+	TWeakObjectPtr<const ANavigationData> NavData;
+	double FoundTime = 0.0;
+};
+
+/**
+ * Request layer in front of AAIController moves.
+ * Behaviors that re-issue MoveToLocation every update (chasing, guarding, cohesion) go through
+ * RequestMove, which drops requests whose goal moved less than GoalTolerance, allows one repath
+ * per MinRepathInterval per agent (keeping only the newest goal), and reuses a recent path when
+ * another agent already pathed between the same start and goal cells.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UAINavigationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ============================================
+	// Configuration
+	// ============================================
+
+	// A running move is kept when the new goal is this close to its goal
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Navigation")
+	float GoalTolerance = 100.0f;
+
+	// Minimum seconds between repaths of one agent while it is moving
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Navigation")
+	float MinRepathInterval = 0.25f;
+
+	// Start and goal are quantized to cells of this size to find shareable paths
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Navigation")
+	float PathCacheCellSize = 300.0f;
+
+	// Seconds a cached path may be reused
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Navigation")
+	float PathCacheLifetime = 2.0f;
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Navigation")
+	int32 MaxCachedPaths = 256;
+
+	// ============================================
+	// Requests
+	// ============================================
+
+	EAINavRequestResult RequestMove(AAIController* Controller, const FVector& Goal, float AcceptanceRadius);
+
+	// Stops the controller and forgets any deferred goal
+	void CancelMove(AAIController* Controller);
+
+	UFUNCTION(BlueprintCallable, Category = "AI Navigation")
+	FAINavigationStats GetNavigationStats() const { return NavigationStats; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	TMap<TObjectKey<AAIController>, FAINavAgentState> Agents;
+	TSet<TObjectKey<AAIController>> PendingAgents;
+	TMap<TPair<FIntVector, FIntVector>, FAICachedPath> PathCache;
+
+	// Counts for the current stats window
+	int32 NumRepaths = 0;
+	int32 NumPathfinds = 0;
+	int32 NumCacheHits = 0;
+	int32 NumMerged = 0;
+	int32 NumDeferred = 0;
+	float StatsWindowTime = 0.0f;
+
+	FAINavigationStats NavigationStats;
+
+	bool IssueMove(AAIController* Controller, FAINavAgentState& Agent, const FVector& Goal, float AcceptanceRadius);
+	void FlushPendingMoves();
+	void UpdateStats();
+	void PruneCache();
+
+	FIntVector GetCell(const FVector& Location) const;
+};
@@ -0,0 +1,226 @@
+// AI Proximity Subsystem Implementation
+
+#include "AIProximitySubsystem.h"
+#include "CombatSpatialHashSubsystem.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UAIProximitySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAIProximitySubsystem::Deinitialize()
+{
+	Subscribers.Empty();
+	OccupiedAgents.Empty();
+	PendingEvents.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UAIProximitySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAIProximitySubsystem, STATGROUP_Tickables);
+}
+
+void UAIProximitySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+	UCombatSpatialHashSubsystem* SpatialHash = World->GetSubsystem<UCombatSpatialHashSubsystem>();
+	if (!SpatialHash || Subscribers.Num() == 0) return;
+
+	if (bMaxRingRadiusDirty)
+	{
+		RecomputeMaxRingRadius();
+	}
+
+	++EvaluationFrame;
+
+	// Only agents in cells around a player are tested against that player
+	FCombatEntityQueryFilter Filter;
+	TArray<AActor*> Candidates;
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		APawn* PlayerPawn = It->Get() ? It->Get()->GetPawn() : nullptr;
+		if (!PlayerPawn) continue;
+
+		SpatialHash->QuerySphere(PlayerPawn->GetActorLocation(), MaxRingRadius, Filter, Candidates);
+
+		for (AActor* Agent : Candidates)
+		{
+			if (auto* Rings = Subscribers.Find(Agent))
+			{
+				EvaluateAgent(Agent, PlayerPawn, *Rings);
+			}
+		}
+	}
+
+	CollectExits();
+	DispatchEvents();
+}
+
+// ============================================
+// Subscriptions
+// ============================================
+
+void UAIProximitySubsystem::SubscribeRing(AActor* Agent, FName RingName, float Radius, FAIProximityRingDelegate Callback)
+{
+	if (!Agent || Radius <= 0.0f) return;
+
+	auto& Rings = Subscribers.FindOrAdd(Agent);
+
+	FAIProximityRing* Ring = Rings.FindByPredicate([RingName](const FAIProximityRing& Existing) { return Existing.Name == RingName; });
+	if (!Ring)
+	{
+		Ring = &Rings.AddDefaulted_GetRef();
+		Ring->Name = RingName;
+	}
+
+	Ring->Radius = Radius;
+	Ring->Callback = MoveTemp(Callback);
+	Ring->PlayersInside.Reset();
+	Ring->LastSeenFrames.Reset();
+
+	MaxRingRadius = FMath::Max(MaxRingRadius, Radius);
+}
+
+void UAIProximitySubsystem::UnsubscribeRing(AActor* Agent, FName RingName)
+{
+	auto* Rings = Subscribers.Find(Agent);
+	if (!Rings) return;
+
+	Rings->RemoveAll([RingName](const FAIProximityRing& Existing) { return Existing.Name == RingName; });
+	bMaxRingRadiusDirty = true;
+
+	if (Rings->Num() == 0)
+	{
+		UnsubscribeAgent(Agent);
+	}
+}
+
+void UAIProximitySubsystem::UnsubscribeAgent(AActor* Agent)
+{
+	if (Subscribers.Remove(Agent) > 0)
+	{
+		OccupiedAgents.Remove(Agent);
+		bMaxRingRadiusDirty = true;
+	}
+}
+
+bool UAIProximitySubsystem::IsPlayerInsideRing(AActor* Agent, FName RingName, AActor* Player) const
+{
+	const auto* Rings = Subscribers.Find(Agent);
+	if (!Rings || !Player) return false;
+
+	const FAIProximityRing* Ring = Rings->FindByPredicate([RingName](const FAIProximityRing& Existing) { return Existing.Name == RingName; });
+	return Ring && Ring->PlayersInside.Contains(Player);
+}
+
+void UAIProximitySubsystem::RecomputeMaxRingRadius()
+{
+	MaxRingRadius = 0.0f;
+	for (const auto& Pair : Subscribers)
+	{
+		for (const FAIProximityRing& Ring : Pair.Value)
+		{
+			MaxRingRadius = FMath::Max(MaxRingRadius, Ring.Radius);
+		}
+	}
+
+	bMaxRingRadiusDirty = false;
+}
+
+// ============================================
+// Evaluation
+// ============================================
+
+void UAIProximitySubsystem::EvaluateAgent(AActor* Agent, AActor* Player, TArray<FAIProximityRing, TInlineAllocator<2>>& Rings)
+{
+	const float DistanceSq = FVector::DistSquared(Agent->GetActorLocation(), Player->GetActorLocation());
+
+	for (FAIProximityRing& Ring : Rings)
+	{
+		const bool bInside = DistanceSq <= FMath::Square(Ring.Radius);
+		const int32 Index = Ring.PlayersInside.IndexOfByKey(Player);
+
+		if (bInside && Index == INDEX_NONE)
+		{
+			Ring.PlayersInside.Add(Player);
+			Ring.LastSeenFrames.Add(EvaluationFrame);
+			OccupiedAgents.Add(Agent);
+			PendingEvents.Add({ Agent, Ring.Name, Player, true });
+		}
+		else if (bInside)
+		{
+			Ring.LastSeenFrames[Index] = EvaluationFrame;
+		}
+		else if (Index != INDEX_NONE)
+		{
+			Ring.PlayersInside.RemoveAtSwap(Index);
+			Ring.LastSeenFrames.RemoveAtSwap(Index);
+			PendingEvents.Add({ Agent, Ring.Name, Player, false });
+		}
+	}
+}
+
+void UAIProximitySubsystem::CollectExits()
+{
+	// Players that were inside but are no longer near the agent at all (or no longer exist)
+	for (auto It = OccupiedAgents.CreateIterator(); It; ++It)
+	{
+		auto* Rings = Subscribers.Find(*It);
+		bool bStillOccupied = false;
+
+		if (Rings)
+		{
+			for (FAIProximityRing& Ring : *Rings)
+			{
+				for (int32 Index = Ring.PlayersInside.Num() - 1; Index >= 0; --Index)
+				{
+					if (Ring.LastSeenFrames[Index] != EvaluationFrame)
+					{
+						PendingEvents.Add({ *It, Ring.Name, Ring.PlayersInside[Index], false });
+						Ring.PlayersInside.RemoveAtSwap(Index);
+						Ring.LastSeenFrames.RemoveAtSwap(Index);
+					}
+				}
+
+				bStillOccupied |= Ring.PlayersInside.Num() > 0;
+			}
+		}
+
+		if (!bStillOccupied)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UAIProximitySubsystem::DispatchEvents()
+{
+	// Callbacks may subscribe, unsubscribe or destroy agents, so look each one up again
+	TArray<FAIProximityEvent> Events = MoveTemp(PendingEvents);
+	PendingEvents.Reset();
+
+	for (const FAIProximityEvent& Event : Events)
+	{
+		auto* Rings = Subscribers.Find(Event.Agent);
+		if (!Rings) continue;
+
+		FAIProximityRing* Ring = Rings->FindByPredicate([&Event](const FAIProximityRing& Existing) { return Existing.Name == Event.RingName; });
+		if (Ring)
+		{
+			// Copy, the callback may resubscribe and reallocate the ring array
+			FAIProximityRingDelegate Callback = Ring->Callback;
+			Callback.ExecuteIfBound(Event.RingName, Event.Player.Get(), Event.bEntered);
+		}
+	}
+}
@@ -0,0 +1,93 @@
+// AI Proximity Subsystem - Player enter/exit events for radius rings around AI agents
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AIProximitySubsystem.generated.h"
+
+// Ring name, player that crossed it, true when the player is now inside
+DECLARE_DELEGATE_ThreeParams(FAIProximityRingDelegate, FName, AActor*, bool);
+
+/**
+ * One radius around an agent and the players currently inside it
+ */
+struct FAIProximityRing
+{
+	FName Name;
+	float Radius = 0.0f;
+	FAIProximityRingDelegate Callback;
+
+	// Players inside, and the evaluation that last saw each of them inside
+	TArray<TWeakObjectPtr<AActor>, TInlineAllocator<1>> PlayersInside;
+	TArray<uint32, TInlineAllocator<1>> LastSeenFrames;
+};
+
+/**
+ * A ring crossing waiting to be delivered once evaluation is done
+ */
+struct FAIProximityEvent
+{
+	TObjectKey<AActor> Agent;
+	FName RingName;
+	TWeakObjectPtr<AActor> Player;
+	bool bEntered = false;
+};
+
+/**
+ * Event-driven replacement for per-tick player distance polling.
+ * Agents subscribe rings with a radius, and the subsystem reports when a player crosses one.
+ * Each tick only agents the combat spatial hash places near a player are tested, so agents far
+ * from every player cost nothing.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UAIProximitySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ============================================
+	// Subscriptions
+	// ============================================
+
+	// Adds or resizes a ring. A resized ring forgets who was inside and re-reports entries.
+	void SubscribeRing(AActor* Agent, FName RingName, float Radius, FAIProximityRingDelegate Callback);
+
+	// Removes rings without raising exit events
+	void UnsubscribeRing(AActor* Agent, FName RingName);
+	void UnsubscribeAgent(AActor* Agent);
+
+	UFUNCTION(BlueprintCallable, Category = "AI Proximity")
+	bool IsPlayerInsideRing(AActor* Agent, FName RingName, AActor* Player) const;
+
+	UFUNCTION(BlueprintCallable, Category = "AI Proximity")
+	int32 GetNumSubscribedAgents() const { return Subscribers.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	TMap<TObjectKey<AActor>, TArray<FAIProximityRing, TInlineAllocator<2>>> Subscribers;
+
+	// Agents with at least one player inside a ring, checked for exits every tick
+	TSet<TObjectKey<AActor>> OccupiedAgents;
+
+	TArray<FAIProximityEvent> PendingEvents;
+
+	float MaxRingRadius = 0.0f;
+	bool bMaxRingRadiusDirty = false;
+	uint32 EvaluationFrame = 0;
+
+	void EvaluateAgent(AActor* Agent, AActor* Player, TArray<FAIProximityRing, TInlineAllocator<2>>& Rings);
+	void CollectExits();
+	void DispatchEvents();
+	void RecomputeMaxRingRadius();
+};
@@ -0,0 +1,191 @@
+// AI Target Motion Subsystem Implementation
+
+#include "AITargetMotionSubsystem.h"
+#include "GameFramework/Actor.h"
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UAITargetMotionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAITargetMotionSubsystem::Deinitialize()
+{
+	Targets.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UAITargetMotionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAITargetMotionSubsystem, STATGROUP_Tickables);
+}
+
+void UAITargetMotionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	for (auto It = Targets.CreateIterator(); It; ++It)
+	{
+		FAITargetMotion& Motion = It.Value();
+		if (!Motion.Target.IsValid() || Now - Motion.LastQueryTime > TrackIdleLifetime)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		SampleTarget(Motion, Now);
+	}
+}
+
+// ============================================
+// History
+// ============================================
+
+FAITargetMotion& UAITargetMotionSubsystem::FindOrTrack(AActor* Target)
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	FAITargetMotion* Motion = Targets.Find(Target);
+	if (!Motion)
+	{
+		Motion = &Targets.Add(Target);
+		Motion->Target = Target;
+		SampleTarget(*Motion, Now);
+	}
+
+	Motion->LastQueryTime = Now;
+	return *Motion;
+}
+
+void UAITargetMotionSubsystem::SampleTarget(FAITargetMotion& Motion, double Now) const
+{
+	constexpr int32 HistorySize = FAITargetMotion::HistorySize;
+
+	const AActor* Target = Motion.Target.Get();
+	if (!Target) return;
+
+	Motion.Location = Target->GetActorLocation();
+
+	if (Motion.Count > 0)
+	{
+		const int32 Newest = (Motion.Head + HistorySize - 1) % HistorySize;
+		const double Elapsed = Now - Motion.Times[Newest];
+		if (Elapsed < SampleInterval) return;
+
+		// Teleports, respawns and grapple pulls would poison the estimate
+		if (FVector::Dist(Motion.Location, Motion.Positions[Newest]) > MaxTrackedSpeed * Elapsed)
+		{
+			Motion.Count = 0;
+		}
+	}
+
+	Motion.Positions[Motion.Head] = Motion.Location;
+	Motion.Times[Motion.Head] = Now;
+	Motion.Head = (Motion.Head + 1) % HistorySize;
+	Motion.Count = FMath::Min(Motion.Count + 1, HistorySize);
+
+	// Until there is history, trust whatever the actor reports
+	if (Motion.Count < 2)
+	{
+		Motion.Velocity = Target->GetVelocity();
+		return;
+	}
+
+	const int32 Oldest = (Motion.Head + HistorySize - Motion.Count) % HistorySize;
+	const int32 Newest = (Motion.Head + HistorySize - 1) % HistorySize;
+	const double Span = Motion.Times[Newest] - Motion.Times[Oldest];
+
+	Motion.Velocity = Span > 0.0 ? (Motion.Positions[Newest] - Motion.Positions[Oldest]) / Span : FVector::ZeroVector;
+}
+
+// ============================================
+// Queries
+// ============================================
+
+void UAITargetMotionSubsystem::SolveIntercepts(TArrayView<FAIInterceptQuery> Queries)
+{
+	// Batches are usually grouped by target, so one lookup serves a run of queries
+	const AActor* LastTarget = nullptr;
+	const FAITargetMotion* Motion = nullptr;
+
+	for (FAIInterceptQuery& Query : Queries)
+	{
+		if (!Query.Target)
+		{
+			Query.AimLocation = Query.ShooterLocation;
+			Query.TimeToImpact = 0.0f;
+			Query.bSolved = false;
+			continue;
+		}
+
+		if (Query.Target != LastTarget)
+		{
+			Motion = &FindOrTrack(Query.Target);
+			LastTarget = Query.Target;
+		}
+
+		const FVector Offset = Motion->Location - Query.ShooterLocation;
+
+		float Time = 0.0f;
+		Query.bSolved = Query.ProjectileSpeed > 0.0f && SolveInterceptTime(Offset, Motion->Velocity, Query.ProjectileSpeed, Time);
+		if (!Query.bSolved)
+		{
+			// The target outruns the projectile, lead by straight-line flight time instead
+			Time = Query.ProjectileSpeed > 0.0f ? Offset.Size() / Query.ProjectileSpeed : 0.0f;
+		}
+
+		Query.TimeToImpact = FMath::Min(Time, MaxLeadTime);
+		Query.AimLocation = Motion->Location + Motion->Velocity * Query.TimeToImpact;
+	}
+}
+
+FVector UAITargetMotionSubsystem::PredictInterceptLocation(const FVector& ShooterLocation, AActor* Target, float ProjectileSpeed)
+{
+	FAIInterceptQuery Query;
+	Query.ShooterLocation = ShooterLocation;
+	Query.Target = Target;
+	Query.ProjectileSpeed = ProjectileSpeed;
+
+	SolveIntercepts(MakeArrayView(&Query, 1));
+	return Query.AimLocation;
+}
+
+FVector UAITargetMotionSubsystem::GetTargetVelocity(AActor* Target)
+{
+	return Target ? FindOrTrack(Target).Velocity : FVector::ZeroVector;
+}
+
+bool UAITargetMotionSubsystem::SolveInterceptTime(const FVector& Offset, const FVector& Velocity, float Speed, float& OutTime)
+{
+	// |Offset + Velocity * t| = Speed * t
+	const double A = Velocity.SizeSquared() - FMath::Square(static_cast<double>(Speed));
+	const double B = 2.0 * FVector::DotProduct(Offset, Velocity);
+	const double C = Offset.SizeSquared();
+
+	if (FMath::IsNearlyZero(A))
+	{
+		// Target as fast as the projectile, only catchable when closing in
+		if (B >= 0.0) return false;
+
+		OutTime = static_cast<float>(-C / B);
+		return true;
+	}
+
+	const double Discriminant = B * B - 4.0 * A * C;
+	if (Discriminant < 0.0) return false;
+
+	const double Root = FMath::Sqrt(Discriminant);
+	const double TimeA = (-B - Root) / (2.0 * A);
+	const double TimeB = (-B + Root) / (2.0 * A);
+
+	const double Time = TimeA > 0.0 && (TimeB <= 0.0 || TimeA < TimeB) ? TimeA : TimeB;
+	if (Time <= 0.0) return false;
+
+	OutTime = static_cast<float>(Time);
+	return true;
+}
@@ -0,0 +1,115 @@
+// AI Target Motion Subsystem - Shared motion history of aimed-at targets and projectile lead solving
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AITargetMotionSubsystem.generated.h"
+
+/**
+ * Recent positions of one target and the velocity estimated from them this frame
+ */
+struct FAITargetMotion
+{
+	static constexpr int32 HistorySize = 8;
+
+	TWeakObjectPtr<AActor> Target;
+
+	// Ring buffer, Head is the next slot written
+	TStaticArray<FVector, HistorySize> Positions;
+	TStaticArray<double, HistorySize> Times;
+	int32 Head = 0;
+	int32 Count = 0;
+
+	FVector Location = FVector::ZeroVector;
+	FVector Velocity = FVector::ZeroVector;
+
+	double LastQueryTime = 0.0;
+};
+
+/**
+ * One shooter aiming at one target. The solver fills in the outputs.
+ */
+struct FAIInterceptQuery
+{
+	FVector ShooterLocation = FVector::ZeroVector;
+	AActor* Target = nullptr;
+	float ProjectileSpeed = 1000.0f;
+
+	FVector AimLocation = FVector::ZeroVector;
+	float TimeToImpact = 0.0f;
+
+	// False when the projectile cannot catch the target and AimLocation is a plain lead guess
+	bool bSolved = false;
+};
+
+/**
+ * Samples the location of every target an AI recently aimed at into a short ring buffer, once
+ * per frame for all shooters, and derives a smoothed velocity from it. Intercept queries are
+ * solved in batches against that cached velocity, so a squad of archers on one player costs
+ * one history update per frame. Targets nobody aims at for a while stop being sampled.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UAITargetMotionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ============================================
+	// Configuration
+	// ============================================
+
+	// Minimum time between history samples, so the buffer spans roughly the same time at any frame rate
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Target Motion")
+	float SampleInterval = 0.03f;
+
+	// Longer leads than this are clamped, a far target can change direction before impact
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Target Motion")
+	float MaxLeadTime = 2.0f;
+
+	// Movement faster than this between samples is a teleport and restarts the history
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Target Motion")
+	float MaxTrackedSpeed = 4000.0f;
+
+	// Targets nobody aimed at for this long are no longer sampled
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Target Motion")
+	float TrackIdleLifetime = 5.0f;
+
+	// ============================================
+	// Queries
+	// ============================================
+
+	// Solves every query in place. Targets seen for the first time are tracked from now on.
+	void SolveIntercepts(TArrayView<FAIInterceptQuery> Queries);
+
+	// Where a projectile fired now from ShooterLocation should aim to meet Target
+	UFUNCTION(BlueprintCallable, Category = "AI Target Motion")
+	FVector PredictInterceptLocation(const FVector& ShooterLocation, AActor* Target, float ProjectileSpeed);
+
+	// Estimated velocity, falling back to the actor's own until history exists
+	UFUNCTION(BlueprintCallable, Category = "AI Target Motion")
+	FVector GetTargetVelocity(AActor* Target);
+
+	UFUNCTION(BlueprintCallable, Category = "AI Target Motion")
+	int32 GetNumTrackedTargets() const { return Targets.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	TMap<TObjectKey<AActor>, FAITargetMotion> Targets;
+
+	FAITargetMotion& FindOrTrack(AActor* Target);
+	void SampleTarget(FAITargetMotion& Motion, double Now) const;
+
+	// Smallest positive time at which a projectile of Speed meets a target at Offset moving with Velocity
+	static bool SolveInterceptTime(const FVector& Offset, const FVector& Velocity, float Speed, float& OutTime);
+};
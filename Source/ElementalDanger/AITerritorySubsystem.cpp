@@ -0,0 +1,213 @@
+// AI Territory Subsystem Implementation
+
+#include "AITerritorySubsystem.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UAITerritorySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAITerritorySubsystem::Deinitialize()
+{
+	Territories.Empty();
+	PendingEvents.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UAITerritorySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAITerritorySubsystem, STATGROUP_Tickables);
+}
+
+void UAITerritorySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Territories.Num() == 0) return;
+
+	TArray<AActor*, TInlineAllocator<4>> PlayerPawns;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (APawn* PlayerPawn = It->Get() ? It->Get()->GetPawn() : nullptr)
+		{
+			PlayerPawns.Add(PlayerPawn);
+		}
+	}
+
+	for (auto& Pair : Territories)
+	{
+		EvaluateTerritory(Pair.Key, Pair.Value, PlayerPawns);
+	}
+
+	DispatchEvents();
+}
+
+// ============================================
+// Registration
+// ============================================
+
+int32 UAITerritorySubsystem::RegisterGuard(AActor* Guard, const FVector& Center, float Radius, float WatchRadius, FAITerritoryEventDelegate Callback)
+{
+	if (!Guard || Radius <= 0.0f) return INDEX_NONE;
+
+	int32 TerritoryId = INDEX_NONE;
+	for (const auto& Pair : Territories)
+	{
+		if (FMath::IsNearlyEqual(Pair.Value.Radius, Radius) &&
+			FVector::DistSquared(Pair.Value.Center, Center) <= FMath::Square(CenterTolerance))
+		{
+			TerritoryId = Pair.Key;
+			break;
+		}
+	}
+
+	if (TerritoryId == INDEX_NONE)
+	{
+		TerritoryId = NextTerritoryId++;
+		FAITerritory& NewTerritory = Territories.Add(TerritoryId);
+		NewTerritory.Center = Center;
+		NewTerritory.Radius = Radius;
+	}
+
+	FAITerritory& Territory = Territories[TerritoryId];
+	Territory.WatchRadius = FMath::Max3(Territory.WatchRadius, WatchRadius, Radius);
+	Territory.Guards.Add(Guard, Callback);
+
+	// A late guard hears about players already there
+	for (const TWeakObjectPtr<AActor>& Intruder : Territory.Intruders)
+	{
+		Callback.ExecuteIfBound(EAITerritoryEvent::Invaded, Intruder.Get());
+	}
+	for (const TWeakObjectPtr<AActor>& Suspect : Territory.CheeseSuspects)
+	{
+		Callback.ExecuteIfBound(EAITerritoryEvent::CheeseSuspected, Suspect.Get());
+	}
+
+	return TerritoryId;
+}
+
+void UAITerritorySubsystem::UnregisterGuard(AActor* Guard, int32 TerritoryId)
+{
+	FAITerritory* Territory = Territories.Find(TerritoryId);
+	if (!Territory) return;
+
+	Territory->Guards.Remove(Guard);
+	if (Territory->Guards.Num() == 0)
+	{
+		Territories.Remove(TerritoryId);
+	}
+}
+
+// ============================================
+// Evaluation
+// ============================================
+
+void UAITerritorySubsystem::EvaluateTerritory(int32 TerritoryId, FAITerritory& Territory, TConstArrayView<AActor*> Players)
+{
+	// Destroyed players leave silently, players that lost their pawn count as having left
+	Territory.Intruders.RemoveAll([](const TWeakObjectPtr<AActor>& Player) { return !Player.IsValid(); });
+	Territory.CheeseSuspects.RemoveAll([](const TWeakObjectPtr<AActor>& Player) { return !Player.IsValid(); });
+
+	for (int32 Index = Territory.Intruders.Num() - 1; Index >= 0; --Index)
+	{
+		AActor* Player = Territory.Intruders[Index].Get();
+		if (!Players.Contains(Player))
+		{
+			UpdateMembership(TerritoryId, Territory.Intruders, Player, false, EAITerritoryEvent::Invaded, EAITerritoryEvent::Left);
+		}
+	}
+	for (int32 Index = Territory.CheeseSuspects.Num() - 1; Index >= 0; --Index)
+	{
+		AActor* Player = Territory.CheeseSuspects[Index].Get();
+		if (!Players.Contains(Player))
+		{
+			UpdateMembership(TerritoryId, Territory.CheeseSuspects, Player, false, EAITerritoryEvent::CheeseSuspected, EAITerritoryEvent::CheeseCleared);
+		}
+	}
+
+	for (AActor* Player : Players)
+	{
+		const float DistanceSquared = FVector::DistSquared(Player->GetActorLocation(), Territory.Center);
+		const bool bInside = DistanceSquared <= FMath::Square(Territory.Radius);
+		const bool bWatched = !bInside && DistanceSquared <= FMath::Square(Territory.WatchRadius);
+
+		UpdateMembership(TerritoryId, Territory.Intruders, Player, bInside, EAITerritoryEvent::Invaded, EAITerritoryEvent::Left);
+		UpdateMembership(TerritoryId, Territory.CheeseSuspects, Player, bWatched, EAITerritoryEvent::CheeseSuspected, EAITerritoryEvent::CheeseCleared);
+	}
+}
+
+void UAITerritorySubsystem::UpdateMembership(int32 TerritoryId, TArray<TWeakObjectPtr<AActor>, TInlineAllocator<1>>& List,
+	AActor* Player, bool bMember, EAITerritoryEvent EnterEvent, EAITerritoryEvent ExitEvent)
+{
+	const int32 Index = List.IndexOfByKey(Player);
+	if (bMember == (Index != INDEX_NONE)) return;
+
+	if (bMember)
+	{
+		List.Add(Player);
+	}
+	else
+	{
+		List.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
+
+	FAITerritoryEvent& Event = PendingEvents.AddDefaulted_GetRef();
+	Event.TerritoryId = TerritoryId;
+	Event.Type = bMember ? EnterEvent : ExitEvent;
+	Event.Player = Player;
+}
+
+void UAITerritorySubsystem::DispatchEvents()
+{
+	if (PendingEvents.Num() == 0) return;
+
+	// Callbacks may register or unregister guards, so deliver from a copy
+	TArray<FAITerritoryEvent> Events = MoveTemp(PendingEvents);
+	PendingEvents.Reset();
+
+	for (const FAITerritoryEvent& Event : Events)
+	{
+		const FAITerritory* Territory = Territories.Find(Event.TerritoryId);
+		if (!Territory) continue;
+
+		TArray<FAITerritoryEventDelegate, TInlineAllocator<8>> Callbacks;
+		for (const auto& Pair : Territory->Guards)
+		{
+			Callbacks.Add(Pair.Value);
+		}
+
+		for (const FAITerritoryEventDelegate& Callback : Callbacks)
+		{
+			Callback.ExecuteIfBound(Event.Type, Event.Player.Get());
+		}
+	}
+}
+
+// ============================================
+// Queries
+// ============================================
+
+bool UAITerritorySubsystem::IsOccupied(int32 TerritoryId) const
+{
+	const FAITerritory* Territory = Territories.Find(TerritoryId);
+	return Territory && (Territory->Intruders.Num() > 0 || Territory->CheeseSuspects.Num() > 0);
+}
+
+bool UAITerritorySubsystem::IsIntruder(int32 TerritoryId, const AActor* Player) const
+{
+	const FAITerritory* Territory = Territories.Find(TerritoryId);
+	return Territory && Territory->Intruders.Contains(Player);
+}
+
+bool UAITerritorySubsystem::IsCheeseSuspect(int32 TerritoryId, const AActor* Player) const
+{
+	const FAITerritory* Territory = Territories.Find(TerritoryId);
+	return Territory && Territory->CheeseSuspects.Contains(Player);
+}
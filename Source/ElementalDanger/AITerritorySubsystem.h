@@ -0,0 +1,115 @@
+// AI Territory Subsystem - Shared guard territories and the players occupying them
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AITerritorySubsystem.generated.h"
+
+/**
+ * Occupancy change reported to a territory's guards
+ */
+UENUM(BlueprintType)
+enum class EAITerritoryEvent : uint8
+{
+	Invaded             UMETA(DisplayName = "Invaded"),
+	Left                UMETA(DisplayName = "Left"),
+	CheeseSuspected     UMETA(DisplayName = "Cheese Suspected"),
+	CheeseCleared       UMETA(DisplayName = "Cheese Cleared")
+};
+
+// Territory event, player it concerns
+DECLARE_DELEGATE_TwoParams(FAITerritoryEventDelegate, EAITerritoryEvent, AActor*);
+
+/**
+ * One registered territory, shared by every guard assigned to the same center and radius
+ */
+struct FAITerritory
+{
+	FVector Center = FVector::ZeroVector;
+	float Radius = 0.0f;
+
+	// Players between Radius and WatchRadius are suspected of attacking from outside
+	float WatchRadius = 0.0f;
+
+	TMap<TObjectKey<AActor>, FAITerritoryEventDelegate> Guards;
+
+	TArray<TWeakObjectPtr<AActor>, TInlineAllocator<1>> Intruders;
+	TArray<TWeakObjectPtr<AActor>, TInlineAllocator<1>> CheeseSuspects;
+};
+
+/**
+ * A territory change waiting to be delivered once evaluation is done
+ */
+struct FAITerritoryEvent
+{
+	int32 TerritoryId = INDEX_NONE;
+	EAITerritoryEvent Type = EAITerritoryEvent::Invaded;
+	TWeakObjectPtr<AActor> Player;
+};
+
+/**
+ * Area guard territories as first-class regions. Guards sharing a center and radius share one
+ * territory; each tick every player is tested once against each territory and guards are told
+ * when a player invades, leaves, or lingers just outside where they could be cheesing.
+ * Guards of an empty territory skip their combat checks entirely.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UAITerritorySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ============================================
+	// Configuration
+	// ============================================
+
+	// Guards whose centers are closer than this join the same territory
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Territory")
+	float CenterTolerance = 100.0f;
+
+	// ============================================
+	// Registration
+	// ============================================
+
+	// Joins or creates the territory at Center and returns its id. Current occupants are re-reported.
+	int32 RegisterGuard(AActor* Guard, const FVector& Center, float Radius, float WatchRadius, FAITerritoryEventDelegate Callback);
+	void UnregisterGuard(AActor* Guard, int32 TerritoryId);
+
+	// ============================================
+	// Queries
+	// ============================================
+
+	// True while a player is inside the territory or suspected of cheesing it
+	bool IsOccupied(int32 TerritoryId) const;
+
+	bool IsIntruder(int32 TerritoryId, const AActor* Player) const;
+	bool IsCheeseSuspect(int32 TerritoryId, const AActor* Player) const;
+
+	UFUNCTION(BlueprintCallable, Category = "AI Territory")
+	int32 GetNumTerritories() const { return Territories.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	TMap<int32, FAITerritory> Territories;
+	int32 NextTerritoryId = 0;
+
+	TArray<FAITerritoryEvent> PendingEvents;
+
+	void EvaluateTerritory(int32 TerritoryId, FAITerritory& Territory, TConstArrayView<AActor*> Players);
+	void DispatchEvents();
+
+	// Adds or removes Player from List and queues the matching event when membership changes
+	void UpdateMembership(int32 TerritoryId, TArray<TWeakObjectPtr<AActor>, TInlineAllocator<1>>& List,
+		AActor* Player, bool bMember, EAITerritoryEvent EnterEvent, EAITerritoryEvent ExitEvent);
+};
@@ -0,0 +1,179 @@
+// AI Threat Map Subsystem Implementation
+
+#include "AIThreatMapSubsystem.h"
+#include "CombatEntity.h"
+#include "NinjaWizardCharacter.h"
+#include "NavigationSystem.h"
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UAIThreatMapSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAIThreatMapSubsystem::Deinitialize()
+{
+	Sources.Empty();
+	Influence.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UAIThreatMapSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAIThreatMapSubsystem, STATGROUP_Tickables);
+}
+
+void UAIThreatMapSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Only sources that changed cell or strength touch the grid
+	for (auto It = Sources.CreateIterator(); It; ++It)
+	{
+		FAIThreatSource& Source = It.Value();
+		AActor* Actor = Source.Actor.Get();
+
+		const float Strength = Actor ? GetSourceStrength(Actor) : 0.0f;
+		const FIntPoint Cell = Actor ? GetCell(Actor->GetActorLocation()) : Source.StampedCell;
+
+		if (Cell != Source.StampedCell || Strength != Source.StampedStrength)
+		{
+			StampSource(Source.StampedCell, -Source.StampedStrength);
+			StampSource(Cell, Strength);
+			Source.StampedCell = Cell;
+			Source.StampedStrength = Strength;
+		}
+
+		if (!Actor)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+// ============================================
+// Sources
+// ============================================
+
+void UAIThreatMapSubsystem::RegisterSource(AActor* Source)
+{
+	if (!Source || Sources.Contains(Source)) return;
+
+	FAIThreatSource& Entry = Sources.Add(Source);
+	Entry.Actor = Source;
+	Entry.StampedCell = GetCell(Source->GetActorLocation());
+}
+
+void UAIThreatMapSubsystem::UnregisterSource(AActor* Source)
+{
+	FAIThreatSource Entry;
+	if (!Source || !Sources.RemoveAndCopyValue(Source, Entry)) return;
+
+	StampSource(Entry.StampedCell, -Entry.StampedStrength);
+}
+
+float UAIThreatMapSubsystem::GetSourceStrength(const AActor* Actor) const
+{
+	if (Actor->IsA<ANinjaWizardCharacter>()) return PlayerThreat;
+
+	// Summon and boss status can change at runtime, so read it from the entity
+	const ACombatEntity* Entity = Cast<ACombatEntity>(Actor);
+	if (!Entity || !Entity->IsAlive()) return 0.0f;
+
+	if (Entity->bIsPlayerSummon) return SummonThreat;
+	if (Entity->ThreatLevel == EEnemyThreatLevel::Boss) return BossThreat;
+
+	return 0.0f;
+}
+
+void UAIThreatMapSubsystem::StampSource(const FIntPoint& Cell, float Strength)
+{
+	if (Strength == 0.0f) return;
+
+	const int32 CellRadius = FMath::CeilToInt(ThreatRadius / CellSize);
+	for (int32 X = -CellRadius; X <= CellRadius; ++X)
+	{
+		for (int32 Y = -CellRadius; Y <= CellRadius; ++Y)
+		{
+			const float Distance = FMath::Sqrt(static_cast<float>(X * X + Y * Y)) * CellSize;
+			if (Distance >= ThreatRadius) continue;
+
+			const FIntPoint Key(Cell.X + X, Cell.Y + Y);
+			float& Value = Influence.FindOrAdd(Key);
+			Value += Strength * (1.0f - Distance / ThreatRadius);
+
+			// Drop cells whose sources all left, within float error
+			if (FMath::Abs(Value) <= KINDA_SMALL_NUMBER)
+			{
+				Influence.Remove(Key);
+			}
+		}
+	}
+}
+
+// ============================================
+// Queries
+// ============================================
+
+FIntPoint UAIThreatMapSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+float UAIThreatMapSubsystem::GetThreatAt(const FVector& Location) const
+{
+	return Influence.FindRef(GetCell(Location));
+}
+
+bool UAIThreatMapSubsystem::FindFleeLocation(const FVector& From, const FVector& ThreatLocation, float Distance, FVector& OutLocation) const
+{
+	UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSystem || NumFleeDirections <= 0 || Distance <= 0.0f) return false;
+
+	const FVector AwayDirection = (From - ThreatLocation).GetSafeNormal2D();
+	const int32 NumSamples = FMath::Max(SamplesPerDirection, 1);
+
+	// Score every direction against the grid, lower is safer
+	TArray<TPair<float, FVector>, TInlineAllocator<16>> Candidates;
+	for (int32 i = 0; i < NumFleeDirections; i++)
+	{
+		const float Angle = 2.0f * PI * i / NumFleeDirections;
+		const FVector Direction(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f);
+
+		float Score = (1.0f - FVector::DotProduct(Direction, AwayDirection)) * AwayFromThreatBias;
+		for (int32 Sample = 1; Sample <= NumSamples; Sample++)
+		{
+			Score += GetThreatAt(From + Direction * (Distance * Sample / NumSamples));
+		}
+
+		Candidates.Emplace(Score, Direction);
+	}
+
+	Candidates.Sort([](const TPair<float, FVector>& A, const TPair<float, FVector>& B) { return A.Key < B.Key; });
+
+	// Navmesh checks only until the safest open direction is found
+	for (const TPair<float, FVector>& Candidate : Candidates)
+	{
+		FVector End = From + Candidate.Value * Distance;
+
+		FVector HitLocation;
+		if (UNavigationSystemV1::NavigationRaycast(GetWorld(), From, End, HitLocation))
+		{
+			if (FVector::Dist2D(From, HitLocation) < Distance * MinClearFraction) continue;
+			End = HitLocation;
+		}
+
+		FNavLocation NavLocation;
+		if (NavSystem->ProjectPointToNavigation(End, NavLocation))
+		{
+			OutLocation = NavLocation.Location;
+			return true;
+		}
+	}
+
+	return false;
+}
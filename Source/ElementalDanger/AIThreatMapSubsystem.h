@@ -0,0 +1,109 @@
+// AI Threat Map Subsystem - Coarse threat influence grid sampled by fleeing creatures
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AIThreatMapSubsystem.generated.h"
+
+/**
+ * A registered actor and the influence it last added to the grid
+ */
+struct FAIThreatSource
+{
+	TWeakObjectPtr<AActor> Actor;
+
+	FIntPoint StampedCell = FIntPoint::ZeroValue;
+	float StampedStrength = 0.0f;
+};
+
+/**
+ * Players, their summons and bosses spread threat over the cells around them with a linear
+ * falloff. A source is only re-stamped when it changes cell or strength, so one cheap pass per
+ * frame keeps the grid current for every fleeing creature. Flee decisions score a ring of
+ * candidate directions against the grid and only verify the winner against the navmesh.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UAIThreatMapSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ============================================
+	// Configuration
+	// ============================================
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Threat Map")
+	float CellSize = 400.0f;
+
+	// Distance at which a source's influence reaches zero
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Threat Map")
+	float ThreatRadius = 2000.0f;
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Threat Map")
+	float PlayerThreat = 1.0f;
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Threat Map")
+	float SummonThreat = 0.5f;
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Threat Map")
+	float BossThreat = 1.5f;
+
+	// Candidate directions evaluated per flee decision
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Threat Map")
+	int32 NumFleeDirections = 12;
+
+	// Grid samples along each candidate direction
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Threat Map")
+	int32 SamplesPerDirection = 3;
+
+	// Score penalty for a candidate pointing straight at the threat being fled
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Threat Map")
+	float AwayFromThreatBias = 0.25f;
+
+	// A raycast blocked before this fraction of the flee distance rejects the direction
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Threat Map")
+	float MinClearFraction = 0.5f;
+
+	// ============================================
+	// Sources
+	// ============================================
+
+	void RegisterSource(AActor* Source);
+	void UnregisterSource(AActor* Source);
+
+	UFUNCTION(BlueprintCallable, Category = "AI Threat Map")
+	int32 GetNumSources() const { return Sources.Num(); }
+
+	// ============================================
+	// Queries
+	// ============================================
+
+	UFUNCTION(BlueprintCallable, Category = "AI Threat Map")
+	float GetThreatAt(const FVector& Location) const;
+
+	// Lowest-threat navigable point about Distance away from From, false without a navigable candidate
+	bool FindFleeLocation(const FVector& From, const FVector& ThreatLocation, float Distance, FVector& OutLocation) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	TMap<TObjectKey<AActor>, FAIThreatSource> Sources;
+
+	// Sparse, cells without influence are absent
+	TMap<FIntPoint, float> Influence;
+
+	float GetSourceStrength(const AActor* Actor) const;
+	void StampSource(const FIntPoint& Cell, float Strength);
+
+	FIntPoint GetCell(const FVector& Location) const;
+};
@@ -0,0 +1,280 @@
+// AI Threat Table Implementation
+
+#include "AIThreatTable.h"
+#include "GameFramework/Actor.h"
+
+namespace
+{
+	// Rebase once stored threat would be this many times larger than current threat
+	constexpr float MaxStoredScale = 1.0e4f;
+}
+
+// ============================================
+// Threat
+// ============================================
+
+void FAIThreatTable::AddThreat(AActor* Actor, float Amount, double Now)
+{
+	if (!Actor || Amount == 0.0f) return;
+
+	if (Heap.Num() == 0)
+	{
+		Epoch = Now;
+	}
+	else if (GetDecayScale(Now) < 1.0f / MaxStoredScale)
+	{
+		Rebase(Now);
+	}
+
+	const float StoredAmount = Amount / GetDecayScale(Now);
+
+	if (const int32* Index = Indices.Find(Actor))
+	{
+		FAIThreatEntry& Entry = Heap[*Index];
+		Entry.Threat = FMath::Max(Entry.Threat + StoredAmount, 0.0f);
+
+		if (StoredAmount > 0.0f)
+		{
+			MinSiftDown(Entry.MinHeapIndex);
+			SiftUp(*Index);
+		}
+		else
+		{
+			MinSiftUp(Entry.MinHeapIndex);
+			SiftDown(*Index);
+		}
+		return;
+	}
+
+	if (Amount < 0.0f || MaxEntries <= 0) return;
+
+	if (Heap.Num() >= MaxEntries)
+	{
+		const int32 WeakestIndex = MinHeap[0];
+		if (Heap[WeakestIndex].Threat >= StoredAmount) return;
+		RemoveAt(WeakestIndex);
+	}
+
+	const int32 NewIndex = Heap.Add({ Actor, StoredAmount, MinHeap.Num() });
+	Indices.Add(Actor, NewIndex);
+	MinHeap.Add(NewIndex);
+	MinSiftUp(Heap[NewIndex].MinHeapIndex);
+	SiftUp(NewIndex);
+}
+
+void FAIThreatTable::Remove(const AActor* Actor)
+{
+	if (const int32* Index = Indices.Find(Actor))
+	{
+		RemoveAt(*Index);
+	}
+}
+
+void FAIThreatTable::Reset()
+{
+	Heap.Reset();
+	Indices.Reset();
+	MinHeap.Reset();
+	Epoch = 0.0;
+}
+
+float FAIThreatTable::GetThreat(const AActor* Actor, double Now) const
+{
+	const int32* Index = Indices.Find(Actor);
+	return Index ? Heap[*Index].Threat * GetDecayScale(Now) : 0.0f;
+}
+
+AActor* FAIThreatTable::GetTopTarget(double Now)
+{
+	while (Heap.Num() > 0)
+	{
+		if (Heap[0].Threat * GetDecayScale(Now) < MinThreat)
+		{
+			Reset();
+			return nullptr;
+		}
+
+		if (AActor* Actor = Heap[0].Actor.ResolveObjectPtr())
+		{
+			return Actor;
+		}
+
+		RemoveAt(0);
+	}
+
+	return nullptr;
+}
+
+void FAIThreatTable::GetTopTargets(int32 Count, double Now, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset();
+	if (Count <= 0 || Heap.Num() == 0) return;
+
+	const float Threshold = MinThreat / GetDecayScale(Now);
+	const auto ByThreat = [this](int32 A, int32 B) { return Heap[A].Threat > Heap[B].Threat; };
+
+	// Frontier of the heap walk, a child can only be next once its parent was taken
+	TArray<int32, TInlineAllocator<16>> Frontier;
+	Frontier.HeapPush(0, ByThreat);
+
+	while (Frontier.Num() > 0 && OutActors.Num() < Count)
+	{
+		int32 Index;
+		Frontier.HeapPop(Index, ByThreat, EAllowShrinking::No);
+		if (Heap[Index].Threat < Threshold) break;
+
+		if (AActor* Actor = Heap[Index].Actor.ResolveObjectPtr())
+		{
+			OutActors.Add(Actor);
+		}
+
+		for (const int32 Child : { 2 * Index + 1, 2 * Index + 2 })
+		{
+			if (Child < Heap.Num())
+			{
+				Frontier.HeapPush(Child, ByThreat);
+			}
+		}
+	}
+}
+
+// ============================================
+// Decay
+// ============================================
+
+float FAIThreatTable::GetDecayScale(double Now) const
+{
+	return DecayRate > 0.0f ? static_cast<float>(FMath::Exp(-DecayRate * (Now - Epoch))) : 1.0f;
+}
+
+void FAIThreatTable::Rebase(double Now)
+{
+	// Uniform scaling keeps the order of both heaps
+	const float Scale = GetDecayScale(Now);
+	for (FAIThreatEntry& Entry : Heap)
+	{
+		Entry.Threat *= Scale;
+	}
+	Epoch = Now;
+}
+
+// ============================================
+// Heap
+// ============================================
+
+void FAIThreatTable::RemoveAt(int32 Index)
+{
+	const int32 LastIndex = Heap.Num() - 1;
+	RemoveFromMinHeap(Heap[Index].MinHeapIndex);
+	Indices.Remove(Heap[Index].Actor);
+
+	if (Index != LastIndex)
+	{
+		Heap[Index] = Heap[LastIndex];
+		Indices[Heap[Index].Actor] = Index;
+		MinHeap[Heap[Index].MinHeapIndex] = Index;
+	}
+	Heap.RemoveAt(LastIndex, 1, EAllowShrinking::No);
+
+	if (Index < Heap.Num())
+	{
+		SiftUp(Index);
+		SiftDown(Index);
+	}
+}
+
+void FAIThreatTable::SiftUp(int32 Index)
+{
+	while (Index > 0)
+	{
+		const int32 Parent = (Index - 1) / 2;
+		if (Heap[Parent].Threat >= Heap[Index].Threat) break;
+
+		SwapEntries(Parent, Index);
+		Index = Parent;
+	}
+}
+
+void FAIThreatTable::SiftDown(int32 Index)
+{
+	while (true)
+	{
+		const int32 Left = 2 * Index + 1;
+		const int32 Right = Left + 1;
+
+		int32 Largest = Index;
+		if (Left < Heap.Num() && Heap[Left].Threat > Heap[Largest].Threat) Largest = Left;
+		if (Right < Heap.Num() && Heap[Right].Threat > Heap[Largest].Threat) Largest = Right;
+		if (Largest == Index) break;
+
+		SwapEntries(Largest, Index);
+		Index = Largest;
+	}
+}
+
+void FAIThreatTable::SwapEntries(int32 A, int32 B)
+{
+	Heap.Swap(A, B);
+	Indices[Heap[A].Actor] = A;
+	Indices[Heap[B].Actor] = B;
+	MinHeap[Heap[A].MinHeapIndex] = A;
+	MinHeap[Heap[B].MinHeapIndex] = B;
+}
+
+// ============================================
+// Min-Heap
+// ============================================
+
+void FAIThreatTable::RemoveFromMinHeap(int32 MinIndex)
+{
+	const int32 LastMinIndex = MinHeap.Num() - 1;
+
+	if (MinIndex != LastMinIndex)
+	{
+		MinHeap[MinIndex] = MinHeap[LastMinIndex];
+		Heap[MinHeap[MinIndex]].MinHeapIndex = MinIndex;
+	}
+	MinHeap.RemoveAt(LastMinIndex, 1, EAllowShrinking::No);
+
+	if (MinIndex < MinHeap.Num())
+	{
+		MinSiftUp(MinIndex);
+		MinSiftDown(MinIndex);
+	}
+}
+
+void FAIThreatTable::MinSiftUp(int32 MinIndex)
+{
+	while (MinIndex > 0)
+	{
+		const int32 Parent = (MinIndex - 1) / 2;
+		if (Heap[MinHeap[Parent]].Threat <= Heap[MinHeap[MinIndex]].Threat) break;
+
+		SwapMinEntries(Parent, MinIndex);
+		MinIndex = Parent;
+	}
+}
+
+void FAIThreatTable::MinSiftDown(int32 MinIndex)
+{
+	while (true)
+	{
+		const int32 Left = 2 * MinIndex + 1;
+		const int32 Right = Left + 1;
+
+		int32 Smallest = MinIndex;
+		if (Left < MinHeap.Num() && Heap[MinHeap[Left]].Threat < Heap[MinHeap[Smallest]].Threat) Smallest = Left;
+		if (Right < MinHeap.Num() && Heap[MinHeap[Right]].Threat < Heap[MinHeap[Smallest]].Threat) Smallest = Right;
+		if (Smallest == MinIndex) break;
+
+		SwapMinEntries(Smallest, MinIndex);
+		MinIndex = Smallest;
+	}
+}
+
+void FAIThreatTable::SwapMinEntries(int32 A, int32 B)
+{
+	MinHeap.Swap(A, B);
+	Heap[MinHeap[A]].MinHeapIndex = A;
+	Heap[MinHeap[B]].MinHeapIndex = B;
+}
@@ -0,0 +1,75 @@
+// AI Threat Table - Bounded per-agent threat ranking with logarithmic updates
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * One actor an agent is angry at. Threat is stored relative to the table's decay epoch.
+ */
+struct FAIThreatEntry
+{
+	TObjectKey<AActor> Actor;
+	float Threat = 0.0f;
+
+	// Position of this entry in the table's min-heap
+	int32 MinHeapIndex = INDEX_NONE;
+};
+
+/**
+ * Threat an agent holds towards other actors, kept as an indexed max-heap so adding threat and
+ * reading the top target are O(log n) and O(1). All threat decays exponentially at the same
+ * rate, which never changes the ordering, so decay is applied lazily through a shared epoch
+ * instead of touching every entry. The table holds at most MaxEntries actors; when full, a new
+ * actor only gets in by out-threatening the weakest entry, which a second min-heap over the same
+ * entries finds in O(1) and evicts in O(log n).
+ */
+struct ELEMENTALDANGER_API FAIThreatTable
+{
+	int32 MaxEntries = 32;
+
+	// Exponential decay rate per second, 0 keeps threat forever
+	float DecayRate = 0.1f;
+
+	// Tables whose top threat decays below this are cleared
+	float MinThreat = 1.0f;
+
+	void AddThreat(AActor* Actor, float Amount, double Now);
+	void Remove(const AActor* Actor);
+	void Reset();
+
+	float GetThreat(const AActor* Actor, double Now) const;
+
+	// Highest threat actor still alive in memory, stale entries on top are dropped on the way
+	AActor* GetTopTarget(double Now);
+
+	// Up to Count actors by descending threat in O(Count log Count), without modifying the heap
+	void GetTopTargets(int32 Count, double Now, TArray<AActor*>& OutActors) const;
+
+	int32 Num() const { return Heap.Num(); }
+
+private:
+	TArray<FAIThreatEntry> Heap;
+	TMap<TObjectKey<AActor>, int32> Indices;
+
+	// Indices into Heap ordered weakest first, for eviction
+	TArray<int32> MinHeap;
+	double Epoch = 0.0;
+
+	// Multiplier turning stored threat into current threat
+	float GetDecayScale(double Now) const;
+
+	// Folds elapsed decay into the stored values before the scale grows too large
+	void Rebase(double Now);
+
+	void RemoveAt(int32 Index);
+	void SiftUp(int32 Index);
+	void SiftDown(int32 Index);
+	void SwapEntries(int32 A, int32 B);
+
+	void RemoveFromMinHeap(int32 MinIndex);
+	void MinSiftUp(int32 MinIndex);
+	void MinSiftDown(int32 MinIndex);
+	void SwapMinEntries(int32 A, int32 B);
+};
@@ -0,0 +1,816 @@
+// AI Tick Manager Subsystem Implementation
+
+#include "AITickManagerSubsystem.h"
+#include "AIBehaviorComponent.h"
+#include "CombatAIComponent.h"
+#include "CombatEntity.h"
+#include "AIProximitySubsystem.h"
+#include "AINavigationSubsystem.h"
+#include "AIController.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+
+UAITickManagerSubsystem::UAITickManagerSubsystem()
+{
+	// Default tiers: full / reduced-rate / movement-only / frozen
+	LODTiers.SetNum(4);
+
+	LODTiers[0].MaxDistance = 2500.0f;
+
+	LODTiers[1].MaxDistance = 6000.0f;
+	LODTiers[1].UpdateInterval = 0.25f;
+	LODTiers[1].bRunCombatDecisions = false;
+	LODTiers[1].bAllowTraces = false;
+
+	LODTiers[2].MaxDistance = 12000.0f;
+	LODTiers[2].UpdateInterval = 1.0f;
+	LODTiers[2].bRunBehavior = false;
+	LODTiers[2].bRunCombatDecisions = false;
+	LODTiers[2].bAllowTraces = false;
+
+	LODTiers[3].MaxDistance = UE_BIG_NUMBER;
+	LODTiers[3].bRunBehavior = false;
+	LODTiers[3].bRunCombatDecisions = false;
+	LODTiers[3].bAllowTraces = false;
+	LODTiers[3].bAllowMovement = false;
+
+	// Ambient wildlife sleeps, hunters and guards stay awake
+	DormantBehaviorTypes = { EAIBehaviorType::Passive, EAIBehaviorType::Neutral };
+}
+
+namespace
+{
+	const FName DormancyRingName(TEXT("Dormancy"));
+}
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UAITickManagerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAITickManagerSubsystem::Deinitialize()
+{
+	// Hand ticking back to any component still registered
+	for (FAIBehaviorBucket& Bucket : Buckets)
+	{
+		for (int32 Index = 0; Index < Bucket.Components.Num(); ++Index)
+		{
+			if (UAIBehaviorComponent* Behavior = Bucket.Components[Index])
+			{
+				Behavior->LocalHotState = Bucket.HotStates[Index];
+				Behavior->HotState = &Behavior->LocalHotState;
+				Behavior->TickManagerIndex = INDEX_NONE;
+				Behavior->TickManager = nullptr;
+				Behavior->SetComponentTickEnabled(true);
+			}
+		}
+	}
+
+	Buckets.Empty();
+	PendingRegistrations.Empty();
+	PendingTypeChanges.Empty();
+	CombatComponents.Empty();
+	DormantAgents.Empty();
+	DormantOwners.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UAITickManagerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAITickManagerSubsystem, STATGROUP_Tickables);
+}
+
+void UAITickManagerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	EnsureBuckets();
+
+	TimeSinceLODEvaluation += DeltaTime;
+	if (bEnableLOD && TimeSinceLODEvaluation >= LODEvaluationInterval)
+	{
+		TimeSinceLODEvaluation = 0.0f;
+		UpdateLODTiers();
+	}
+
+	// Elapsed time accumulates for everyone in one contiguous pass per type;
+	// agents hand the accumulated time to their next decision update.
+	// Tiers that don't run behavior accrue nothing, so waking up never replays that time.
+	for (FAIBehaviorBucket& Bucket : Buckets)
+	{
+		for (FAIBehaviorHotState& State : Bucket.HotStates)
+		{
+			if (GetLODTierSettings(State.LODTier).bRunBehavior)
+			{
+				State.PendingDeltaTime += DeltaTime;
+			}
+			State.TimeSinceLastAction += DeltaTime;
+		}
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double Deadline = bEnableTimeSlicing ? StartTime + (FrameBudgetMs / 1000.0) : TNumericLimits<double>::Max();
+
+	// Agents in combat or near players go first, everyone else shares what is left round-robin
+	int32 UpdatedAgents = 0;
+	bIsTicking = true;
+	RunSchedulerPass(true, PriorityCursor, Deadline, UpdatedAgents);
+	RunSchedulerPass(false, RoundRobinCursor, Deadline, UpdatedAgents);
+	bIsTicking = false;
+
+	UpdateSchedulerStats(UpdatedAgents, static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0));
+
+	FlushPendingChanges();
+}
+
+void UAITickManagerSubsystem::RunSchedulerPass(bool bPriorityPass, FAISchedulerCursor& Cursor, double Deadline, int32& UpdatedAgents)
+{
+	// Resolve the update function once per behavior type instead of switching per agent
+	static const FBehaviorUpdateFunction UpdateFunctions[NumBehaviorTypes] =
+	{
+		&UAIBehaviorComponent::UpdatePassiveBehavior,
+		&UAIBehaviorComponent::UpdateChasingBehavior,
+		&UAIBehaviorComponent::UpdateNeutralBehavior,
+		&UAIBehaviorComponent::UpdateAreaGuardBehavior,
+		&UAIBehaviorComponent::UpdateAggressiveBehavior
+	};
+
+	int32 TotalSlots = 0;
+	for (const FAIBehaviorBucket& Bucket : Buckets)
+	{
+		TotalSlots += Bucket.Components.Num();
+	}
+
+	if (TotalSlots == 0) return;
+
+	if (!Buckets.IsValidIndex(Cursor.BucketIndex))
+	{
+		Cursor = FAISchedulerCursor();
+	}
+
+	// Components can be removed or spawned during updates; removals only null
+	// their slot and additions are deferred, so slot counts stay stable here
+	for (int32 Step = 0; Step < TotalSlots; ++Step)
+	{
+		while (Cursor.SlotIndex >= Buckets[Cursor.BucketIndex].Components.Num())
+		{
+			Cursor.BucketIndex = (Cursor.BucketIndex + 1) % NumBehaviorTypes;
+			Cursor.SlotIndex = 0;
+		}
+
+		const int32 TypeIndex = Cursor.BucketIndex;
+		const int32 SlotIndex = Cursor.SlotIndex++;
+
+		FAIBehaviorBucket& Bucket = Buckets[TypeIndex];
+		UAIBehaviorComponent* Behavior = Bucket.Components[SlotIndex];
+		if (!Behavior || !Behavior->OwnerEntity) continue;
+
+		// BehaviorType is Blueprint-writable, so pick up changes made behind our back
+		const EAIBehaviorType BehaviorType = static_cast<EAIBehaviorType>(TypeIndex);
+		if (Behavior->BehaviorType != BehaviorType)
+		{
+			PendingTypeChanges.AddUnique(Behavior);
+			continue;
+		}
+
+		FAIBehaviorHotState& State = Bucket.HotStates[SlotIndex];
+		if (IsHighPriority(State) != bPriorityPass) continue;
+
+		// Reduced tiers accumulate time and update less often
+		const FAILODTierSettings& Tier = GetLODTierSettings(State.LODTier);
+		if (!Tier.bRunBehavior || State.PendingDeltaTime <= 0.0f || State.PendingDeltaTime + State.StaggerOffset < Tier.UpdateInterval) continue;
+
+		// Out of budget: stop here and resume from this agent next frame
+		if (UpdatedAgents >= MinUpdatesPerFrame && FPlatformTime::Seconds() >= Deadline)
+		{
+			Cursor.SlotIndex = SlotIndex;
+			return;
+		}
+
+		const float StepDeltaTime = State.PendingDeltaTime;
+		State.PendingDeltaTime = 0.0f;
+		State.StaggerOffset = 0.0f;
+
+		if (bCollectBehaviorTimings)
+		{
+			const double UpdateStartTime = FPlatformTime::Seconds();
+			(Behavior->*UpdateFunctions[TypeIndex])(StepDeltaTime);
+			BehaviorUpdateSeconds[TypeIndex] += FPlatformTime::Seconds() - UpdateStartTime;
+			BehaviorUpdateCounts[TypeIndex]++;
+		}
+		else
+		{
+			(Behavior->*UpdateFunctions[TypeIndex])(StepDeltaTime);
+		}
+		UpdatedAgents++;
+	}
+}
+
+bool UAITickManagerSubsystem::IsHighPriority(const FAIBehaviorHotState& State) const
+{
+	return State.bIsInCombat || State.LODTier == EAILODTier::Full;
+}
+
+void UAITickManagerSubsystem::UpdateSchedulerStats(int32 UpdatedAgents, float UpdateTimeMs)
+{
+	SchedulerStats = FAISchedulerStats();
+	SchedulerStats.UpdatedAgents = UpdatedAgents;
+	SchedulerStats.UpdateTimeMs = UpdateTimeMs;
+
+	int32 ActiveAgents = 0;
+	float TotalStaleness = 0.0f;
+
+	for (const FAIBehaviorBucket& Bucket : Buckets)
+	{
+		for (int32 Index = 0; Index < Bucket.Components.Num(); ++Index)
+		{
+			if (!Bucket.Components[Index]) continue;
+
+			const FAIBehaviorHotState& State = Bucket.HotStates[Index];
+			const FAILODTierSettings& Tier = GetLODTierSettings(State.LODTier);
+			if (!Tier.bRunBehavior) continue;
+
+			// Pending time is exactly how long ago this agent last made a decision
+			ActiveAgents++;
+			TotalStaleness += State.PendingDeltaTime;
+			SchedulerStats.MaxStaleness = FMath::Max(SchedulerStats.MaxStaleness, State.PendingDeltaTime);
+
+			if (State.PendingDeltaTime > 0.0f && State.PendingDeltaTime + State.StaggerOffset >= Tier.UpdateInterval)
+			{
+				SchedulerStats.DeferredAgents++;
+			}
+		}
+	}
+
+	SchedulerStats.AverageStaleness = ActiveAgents > 0 ? TotalStaleness / ActiveAgents : 0.0f;
+}
+
+// ============================================
+// Registration
+// ============================================
+
+bool UAITickManagerSubsystem::RegisterBehavior(UAIBehaviorComponent* Behavior)
+{
+	if (!Behavior || !bBatchBehaviorTicks) return false;
+	if (Behavior->TickManagerIndex != INDEX_NONE || PendingRegistrations.Contains(Behavior)) return true;
+
+	// Never grow the hot state arrays while an update holds references into them
+	if (bIsTicking)
+	{
+		PendingRegistrations.Add(Behavior);
+	}
+	else
+	{
+		AddToBucket(Behavior);
+	}
+
+	Behavior->SetComponentTickEnabled(false);
+	return true;
+}
+
+void UAITickManagerSubsystem::UnregisterBehavior(UAIBehaviorComponent* Behavior)
+{
+	if (!Behavior) return;
+
+	// Anything registered had its own tick disabled, give it back
+	bool bWasRegistered = PendingRegistrations.Remove(Behavior) > 0 || Behavior->TickManagerIndex != INDEX_NONE;
+	PendingTypeChanges.Remove(Behavior);
+
+	// Dormant agents are not in a bucket, only their sleep record is dropped
+	const int32 DormantIndex = FindDormantIndex(Behavior);
+	if (DormantIndex != INDEX_NONE)
+	{
+		DormantAgents.RemoveAtSwap(DormantIndex, 1, EAllowShrinking::No);
+		DormantOwners.Remove(Behavior->GetOwner());
+		if (UAIProximitySubsystem* Proximity = GetWorld()->GetSubsystem<UAIProximitySubsystem>())
+		{
+			Proximity->UnsubscribeRing(Behavior->GetOwner(), DormancyRingName);
+		}
+		bWasRegistered = true;
+	}
+
+	if (bWasRegistered)
+	{
+		Behavior->SetComponentTickEnabled(true);
+	}
+
+	if (Behavior->TickManagerIndex == INDEX_NONE) return;
+
+	if (bIsTicking)
+	{
+		// Keep indices stable until the update pass completes
+		FAIBehaviorBucket& Bucket = Buckets[static_cast<int32>(Behavior->ManagedBehaviorType)];
+		Behavior->LocalHotState = Bucket.HotStates[Behavior->TickManagerIndex];
+		Behavior->HotState = &Behavior->LocalHotState;
+		Bucket.Components[Behavior->TickManagerIndex] = nullptr;
+		Behavior->TickManagerIndex = INDEX_NONE;
+		bHasPendingRemovals = true;
+	}
+	else
+	{
+		RemoveFromBucket(Behavior);
+	}
+}
+
+void UAITickManagerSubsystem::RefreshBehaviorType(UAIBehaviorComponent* Behavior)
+{
+	if (!Behavior || Behavior->TickManagerIndex == INDEX_NONE) return;
+	if (Behavior->ManagedBehaviorType == Behavior->BehaviorType) return;
+
+	if (bIsTicking)
+	{
+		PendingTypeChanges.AddUnique(Behavior);
+		return;
+	}
+
+	RemoveFromBucket(Behavior);
+	AddToBucket(Behavior);
+}
+
+void UAITickManagerSubsystem::RegisterCombatAI(UCombatAIComponent* CombatAI)
+{
+	if (!CombatAI) return;
+
+	CombatComponents.AddUnique(CombatAI);
+}
+
+void UAITickManagerSubsystem::UnregisterCombatAI(UCombatAIComponent* CombatAI)
+{
+	CombatComponents.RemoveSwap(CombatAI, EAllowShrinking::No);
+}
+
+// ============================================
+// Queries
+// ============================================
+
+int32 UAITickManagerSubsystem::GetRegisteredCount(EAIBehaviorType BehaviorType) const
+{
+	const int32 TypeIndex = static_cast<int32>(BehaviorType);
+	if (!Buckets.IsValidIndex(TypeIndex)) return 0;
+
+	int32 Count = 0;
+	for (const UAIBehaviorComponent* Behavior : Buckets[TypeIndex].Components)
+	{
+		if (Behavior)
+		{
+			Count++;
+		}
+	}
+	return Count;
+}
+
+int32 UAITickManagerSubsystem::GetTotalRegisteredCount() const
+{
+	int32 Count = 0;
+	for (int32 TypeIndex = 0; TypeIndex < NumBehaviorTypes; ++TypeIndex)
+	{
+		Count += GetRegisteredCount(static_cast<EAIBehaviorType>(TypeIndex));
+	}
+	return Count;
+}
+
+int32 UAITickManagerSubsystem::GetLODTierCount(EAILODTier Tier) const
+{
+	int32 Count = 0;
+	for (const FAIBehaviorBucket& Bucket : Buckets)
+	{
+		for (int32 Index = 0; Index < Bucket.Components.Num(); ++Index)
+		{
+			if (Bucket.Components[Index] && Bucket.HotStates[Index].LODTier == Tier)
+			{
+				Count++;
+			}
+		}
+	}
+	return Count;
+}
+
+float UAITickManagerSubsystem::GetDecisionStaleness(const UAIBehaviorComponent* Behavior) const
+{
+	return Behavior && Behavior->HotState ? Behavior->HotState->PendingDeltaTime : 0.0f;
+}
+
+const FAILODTierSettings& UAITickManagerSubsystem::GetLODTierSettings(EAILODTier Tier) const
+{
+	static const FAILODTierSettings FullTier;
+
+	const int32 TierIndex = static_cast<int32>(Tier);
+	return LODTiers.IsValidIndex(TierIndex) ? LODTiers[TierIndex] : FullTier;
+}
+
+// ============================================
+// LOD
+// ============================================
+
+void UAITickManagerSubsystem::UpdateLODTiers()
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	TArray<FVector, TInlineAllocator<4>> PlayerLocations;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APawn* PlayerPawn = It->Get() ? It->Get()->GetPawn() : nullptr)
+		{
+			PlayerLocations.Add(PlayerPawn->GetActorLocation());
+		}
+	}
+
+	// Nothing to be significant to, keep current tiers
+	if (PlayerLocations.Num() == 0) return;
+
+	auto DistanceToNearestPlayer = [&PlayerLocations](const FVector& Location)
+	{
+		float BestDistanceSquared = TNumericLimits<float>::Max();
+		for (const FVector& PlayerLocation : PlayerLocations)
+		{
+			BestDistanceSquared = FMath::Min(BestDistanceSquared, FVector::DistSquared(Location, PlayerLocation));
+		}
+		return FMath::Sqrt(BestDistanceSquared);
+	};
+
+	// Agents put to sleep after the pass, sleeping removes them from their bucket
+	TArray<UAIBehaviorComponent*, TInlineAllocator<16>> AgentsToSleep;
+
+	for (FAIBehaviorBucket& Bucket : Buckets)
+	{
+		for (int32 Index = 0; Index < Bucket.Components.Num(); ++Index)
+		{
+			UAIBehaviorComponent* Behavior = Bucket.Components[Index];
+			if (!Behavior || !Behavior->OwnerEntity) continue;
+
+			FAIBehaviorHotState& State = Bucket.HotStates[Index];
+			const float Distance = DistanceToNearestPlayer(Behavior->OwnerEntity->GetActorLocation());
+
+			if (CanSleep(Behavior, State, Distance))
+			{
+				AgentsToSleep.Add(Behavior);
+				continue;
+			}
+
+			const EAILODTier NewTier = ComputeLODTier(Distance, State.LODTier);
+			if (NewTier != State.LODTier)
+			{
+				ApplyBehaviorLOD(Behavior, State, NewTier);
+			}
+		}
+	}
+
+	for (UAIBehaviorComponent* Behavior : AgentsToSleep)
+	{
+		SleepAgent(Behavior);
+	}
+
+	for (UCombatAIComponent* CombatAI : CombatComponents)
+	{
+		const AActor* Owner = CombatAI ? CombatAI->GetOwner() : nullptr;
+		if (!Owner || IsOwnerDormant(Owner)) continue;
+
+		const EAILODTier NewTier = ComputeLODTier(DistanceToNearestPlayer(Owner->GetActorLocation()), CombatAI->LODTier);
+		if (NewTier != CombatAI->LODTier)
+		{
+			ApplyCombatLOD(CombatAI, NewTier);
+		}
+		else if (!GetLODTierSettings(NewTier).bRunBehavior && CombatAI->IsComponentTickEnabled() != IsCombatEngaged(CombatAI))
+		{
+			// Entered or left combat while in a tier that doesn't tick
+			ApplyCombatLOD(CombatAI, NewTier);
+		}
+	}
+}
+
+EAILODTier UAITickManagerSubsystem::ComputeLODTier(float Distance, EAILODTier CurrentTier) const
+{
+	const int32 CurrentIndex = static_cast<int32>(CurrentTier);
+
+	// Boundaries are pushed away from the current tier in both directions, so an
+	// agent has to clearly cross an edge before it switches
+	for (int32 TierIndex = 0; TierIndex < LODTiers.Num() - 1; ++TierIndex)
+	{
+		const float Boundary = LODTiers[TierIndex].MaxDistance +
+			(TierIndex < CurrentIndex ? -LODHysteresisDistance : LODHysteresisDistance);
+
+		if (Distance <= Boundary)
+		{
+			return static_cast<EAILODTier>(TierIndex);
+		}
+	}
+
+	return static_cast<EAILODTier>(FMath::Max(LODTiers.Num() - 1, 0));
+}
+
+void UAITickManagerSubsystem::ApplyBehaviorLOD(UAIBehaviorComponent* Behavior, FAIBehaviorHotState& State, EAILODTier NewTier)
+{
+	const FAILODTierSettings& Tier = GetLODTierSettings(NewTier);
+	State.LODTier = NewTier;
+
+	// Stagger reduced-rate agents so they don't all update on the same frame,
+	// without touching the time they have already accrued
+	State.StaggerOffset = Tier.UpdateInterval > 0.0f ? FMath::FRandRange(0.0f, Tier.UpdateInterval) : 0.0f;
+
+	SetMovementEnabled(Behavior->GetOwner(), Tier.bAllowMovement);
+}
+
+void UAITickManagerSubsystem::ApplyCombatLOD(UCombatAIComponent* CombatAI, EAILODTier NewTier)
+{
+	const FAILODTierSettings& Tier = GetLODTierSettings(NewTier);
+	CombatAI->LODTier = NewTier;
+
+	// A fight in progress keeps ticking at full rate, freezing it would strand a swing mid-phase
+	const bool bHeldAwake = !Tier.bRunBehavior && IsCombatEngaged(CombatAI);
+	CombatAI->SetComponentTickInterval(bHeldAwake ? 0.0f : Tier.UpdateInterval);
+	CombatAI->SetComponentTickEnabled(Tier.bRunBehavior || bHeldAwake);
+
+	SetMovementEnabled(CombatAI->GetOwner(), Tier.bAllowMovement);
+}
+
+bool UAITickManagerSubsystem::IsCombatEngaged(const UCombatAIComponent* CombatAI)
+{
+	return CombatAI->bIsAttacking || CombatAI->AttackPhase != EAIAttackPhase::Idle || CombatAI->GetCurrentTarget() != nullptr;
+}
+
+void UAITickManagerSubsystem::SetMovementEnabled(AActor* Owner, bool bEnabled)
+{
+	if (ACharacter* Character = Cast<ACharacter>(Owner))
+	{
+		if (UCharacterMovementComponent* Movement = Character->GetCharacterMovement())
+		{
+			Movement->SetComponentTickEnabled(bEnabled);
+		}
+	}
+}
+
+// ============================================
+// Dormancy
+// ============================================
+
+bool UAITickManagerSubsystem::CanSleep(const UAIBehaviorComponent* Behavior, const FAIBehaviorHotState& State, float DistanceToPlayer) const
+{
+	if (!bEnableDormancy || !DormantBehaviorTypes.Contains(Behavior->BehaviorType)) return false;
+
+	// Wake-ups only come from proximity events about combat entities
+	if (!Cast<ACombatEntity>(Behavior->GetOwner())) return false;
+	if (DistanceToPlayer <= DormancyActivationRadius + LODHysteresisDistance) return false;
+
+	// Never freeze an agent in the middle of something a player could be part of
+	if (State.bIsInCombat || State.bIsFleeing) return false;
+	if (Behavior->CurrentState == EAIState::Attacking || Behavior->CurrentState == EAIState::Chasing) return false;
+
+	// Without proximity events nothing would wake it again
+	return GetWorld()->GetSubsystem<UAIProximitySubsystem>() != nullptr;
+}
+
+void UAITickManagerSubsystem::SleepAgent(UAIBehaviorComponent* Behavior)
+{
+	UWorld* World = GetWorld();
+	UAIProximitySubsystem* Proximity = World->GetSubsystem<UAIProximitySubsystem>();
+	ACombatEntity* Owner = Cast<ACombatEntity>(Behavior->GetOwner());
+	if (!Proximity || !Owner || bIsTicking) return;
+
+	RemoveFromBucket(Behavior);
+
+	FAIDormantAgent& Agent = DormantAgents.AddDefaulted_GetRef();
+	Agent.Behavior = Behavior;
+	Agent.SleepTime = World->GetTimeSeconds();
+
+	// Drop any path in progress before its follower stops ticking
+	AAIController* Controller = Cast<AAIController>(Owner->GetController());
+	if (UAINavigationSubsystem* Navigation = World->GetSubsystem<UAINavigationSubsystem>())
+	{
+		Navigation->CancelMove(Controller);
+	}
+	else if (Controller)
+	{
+		Controller->StopMovement();
+	}
+
+	// Everything that ticks on the pawn and its controller, remembered so wake restores exactly that
+	auto SuspendActor = [&Agent](AActor* Actor)
+	{
+		if (!Actor) return;
+
+		if (Actor->IsActorTickEnabled())
+		{
+			Actor->SetActorTickEnabled(false);
+			Agent.SuspendedActors.Add(Actor);
+		}
+
+		TInlineComponentArray<UActorComponent*> Components(Actor);
+		for (UActorComponent* Component : Components)
+		{
+			if (Component->IsComponentTickEnabled())
+			{
+				Component->SetComponentTickEnabled(false);
+				Agent.SuspendedComponents.Add(Component);
+			}
+		}
+	};
+	SuspendActor(Owner);
+	SuspendActor(Controller);
+
+	if (UCombatAIComponent* CombatAI = Owner->FindComponentByClass<UCombatAIComponent>())
+	{
+		CombatAI->SetTimersPaused(true);
+	}
+
+	DormantOwners.Add(Owner);
+
+	// A player approaching the activation radius wakes it
+	Proximity->SubscribeRing(Owner, DormancyRingName, DormancyActivationRadius,
+		FAIProximityRingDelegate::CreateUObject(this, &UAITickManagerSubsystem::HandleDormancyRing, TWeakObjectPtr<UAIBehaviorComponent>(Behavior)));
+}
+
+void UAITickManagerSubsystem::HandleDormancyRing(FName RingName, AActor* Player, bool bInside, TWeakObjectPtr<UAIBehaviorComponent> Behavior)
+{
+	if (bInside && Behavior.IsValid())
+	{
+		WakeAgent(Behavior.Get());
+	}
+}
+
+void UAITickManagerSubsystem::WakeAgent(UAIBehaviorComponent* Behavior)
+{
+	const int32 DormantIndex = FindDormantIndex(Behavior);
+	if (DormantIndex == INDEX_NONE) return;
+
+	FAIDormantAgent Agent = MoveTemp(DormantAgents[DormantIndex]);
+	DormantAgents.RemoveAtSwap(DormantIndex, 1, EAllowShrinking::No);
+
+	AActor* Owner = Behavior->GetOwner();
+	DormantOwners.Remove(Owner);
+
+	if (UAIProximitySubsystem* Proximity = GetWorld()->GetSubsystem<UAIProximitySubsystem>())
+	{
+		Proximity->UnsubscribeRing(Owner, DormancyRingName);
+	}
+
+	for (const TWeakObjectPtr<AActor>& Actor : Agent.SuspendedActors)
+	{
+		if (Actor.IsValid())
+		{
+			Actor->SetActorTickEnabled(true);
+		}
+	}
+	for (const TWeakObjectPtr<UActorComponent>& Component : Agent.SuspendedComponents)
+	{
+		if (Component.IsValid())
+		{
+			Component->SetComponentTickEnabled(true);
+		}
+	}
+
+	if (UCombatAIComponent* CombatAI = Owner ? Owner->FindComponentByClass<UCombatAIComponent>() : nullptr)
+	{
+		CombatAI->SetTimersPaused(false);
+	}
+
+	// Movement follows the LOD tier the agent slept in until the next evaluation
+	SetMovementEnabled(Owner, GetLODTierSettings(Behavior->HotState->LODTier).bAllowMovement);
+
+	// Timers, stamina and the like jump ahead by the time spent asleep
+	Behavior->CatchUpDormantTime(static_cast<float>(GetWorld()->GetTimeSeconds() - Agent.SleepTime));
+
+	if (bIsTicking)
+	{
+		PendingRegistrations.AddUnique(Behavior);
+	}
+	else
+	{
+		AddToBucket(Behavior);
+	}
+}
+
+bool UAITickManagerSubsystem::IsDormant(const UAIBehaviorComponent* Behavior) const
+{
+	return FindDormantIndex(Behavior) != INDEX_NONE;
+}
+
+int32 UAITickManagerSubsystem::FindDormantIndex(const UAIBehaviorComponent* Behavior) const
+{
+	if (!Behavior || !DormantOwners.Contains(Behavior->GetOwner())) return INDEX_NONE;
+
+	return DormantAgents.IndexOfByPredicate([Behavior](const FAIDormantAgent& Agent) { return Agent.Behavior == Behavior; });
+}
+
+bool UAITickManagerSubsystem::IsOwnerDormant(const AActor* Owner) const
+{
+	return DormantOwners.Contains(Owner);
+}
+
+// ============================================
+// Internal
+// ============================================
+
+void UAITickManagerSubsystem::EnsureBuckets()
+{
+	if (Buckets.Num() != NumBehaviorTypes)
+	{
+		Buckets.SetNum(NumBehaviorTypes);
+	}
+}
+
+void UAITickManagerSubsystem::AddToBucket(UAIBehaviorComponent* Behavior)
+{
+	EnsureBuckets();
+
+	FAIBehaviorBucket& Bucket = Buckets[static_cast<int32>(Behavior->BehaviorType)];
+	const FAIBehaviorHotState* OldData = Bucket.HotStates.GetData();
+
+	Behavior->TickManagerIndex = Bucket.Components.Add(Behavior);
+	Bucket.HotStates.Add(*Behavior->HotState);
+	Behavior->ManagedBehaviorType = Behavior->BehaviorType;
+
+	// Rebind everyone if the array reallocated, otherwise just the new entry
+	RebindHotStates(Bucket, Bucket.HotStates.GetData() == OldData ? Behavior->TickManagerIndex : 0);
+}
+
+void UAITickManagerSubsystem::RemoveFromBucket(UAIBehaviorComponent* Behavior)
+{
+	FAIBehaviorBucket& Bucket = Buckets[static_cast<int32>(Behavior->ManagedBehaviorType)];
+	const int32 Index = Behavior->TickManagerIndex;
+
+	Behavior->LocalHotState = Bucket.HotStates[Index];
+	Behavior->HotState = &Behavior->LocalHotState;
+	Behavior->TickManagerIndex = INDEX_NONE;
+
+	Bucket.Components.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Bucket.HotStates.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+	// The last entry now occupies the freed slot
+	if (Bucket.Components.IsValidIndex(Index))
+	{
+		if (UAIBehaviorComponent* Moved = Bucket.Components[Index])
+		{
+			Moved->TickManagerIndex = Index;
+			Moved->HotState = &Bucket.HotStates[Index];
+		}
+	}
+}
+
+void UAITickManagerSubsystem::CompactBuckets()
+{
+	for (FAIBehaviorBucket& Bucket : Buckets)
+	{
+		for (int32 Index = Bucket.Components.Num() - 1; Index >= 0; --Index)
+		{
+			if (Bucket.Components[Index]) continue;
+
+			Bucket.Components.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			Bucket.HotStates.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+			if (Bucket.Components.IsValidIndex(Index))
+			{
+				if (UAIBehaviorComponent* Moved = Bucket.Components[Index])
+				{
+					Moved->TickManagerIndex = Index;
+					Moved->HotState = &Bucket.HotStates[Index];
+				}
+			}
+		}
+	}
+
+	bHasPendingRemovals = false;
+}
+
+void UAITickManagerSubsystem::FlushPendingChanges()
+{
+	if (bHasPendingRemovals)
+	{
+		CompactBuckets();
+	}
+
+	TArray<UAIBehaviorComponent*> TypeChanges = MoveTemp(PendingTypeChanges);
+	for (UAIBehaviorComponent* Behavior : TypeChanges)
+	{
+		if (IsValid(Behavior))
+		{
+			RefreshBehaviorType(Behavior);
+		}
+	}
+
+	TArray<UAIBehaviorComponent*> Registrations = MoveTemp(PendingRegistrations);
+	for (UAIBehaviorComponent* Behavior : Registrations)
+	{
+		if (IsValid(Behavior) && Behavior->TickManagerIndex == INDEX_NONE)
+		{
+			AddToBucket(Behavior);
+		}
+	}
+}
+
+void UAITickManagerSubsystem::RebindHotStates(FAIBehaviorBucket& Bucket, int32 FirstIndex)
+{
+	for (int32 Index = FirstIndex; Index < Bucket.Components.Num(); ++Index)
+	{
+		if (UAIBehaviorComponent* Behavior = Bucket.Components[Index])
+		{
+			Behavior->HotState = &Bucket.HotStates[Index];
+		}
+	}
+}
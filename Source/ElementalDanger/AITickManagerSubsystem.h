@@ -0,0 +1,266 @@
+// AI Tick Manager Subsystem - Batches AI behavior updates into a single world tick
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AIBehaviorTypes.h"
+#include "UObject/ObjectKey.h"
+#include "AITickManagerSubsystem.generated.h"
+
+class UAIBehaviorComponent;
+class UCombatAIComponent;
+
+/**
+ * All registered behavior components of one behavior type.
+ * HotStates is index-aligned with Components so per-type passes walk contiguous memory.
+ */
+USTRUCT()
+struct FAIBehaviorBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<UAIBehaviorComponent*> Components;
+
+	TArray<FAIBehaviorHotState> HotStates;
+};
+
+/**
+ * Per-frame scheduler statistics
+ */
+USTRUCT(BlueprintType)
+struct FAISchedulerStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI Scheduler")
+	int32 UpdatedAgents = 0;
+
+	// Agents that were due for a decision but ran out of frame budget
+	UPROPERTY(BlueprintReadOnly, Category = "AI Scheduler")
+	int32 DeferredAgents = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI Scheduler")
+	float UpdateTimeMs = 0.0f;
+
+	// Seconds since each active agent's last decision
+	UPROPERTY(BlueprintReadOnly, Category = "AI Scheduler")
+	float AverageStaleness = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "AI Scheduler")
+	float MaxStaleness = 0.0f;
+};
+
+/**
+ * An agent put to sleep and everything that was switched off for it
+ */
+USTRUCT()
+struct FAIDormantAgent
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UAIBehaviorComponent* Behavior = nullptr;
+
+	// World time the agent fell asleep, for catch-up on wake
+	double SleepTime = 0.0;
+
+	// Ticks that were enabled at sleep time and are restored on wake
+	TArray<TWeakObjectPtr<AActor>> SuspendedActors;
+	TArray<TWeakObjectPtr<UActorComponent>> SuspendedComponents;
+};
+
+/**
+ * Position of a round-robin scheduler pass across the per-type buckets
+ */
+struct FAISchedulerCursor
+{
+	int32 BucketIndex = 0;
+	int32 SlotIndex = 0;
+};
+
+/**
+ * Owns a single tick for every UAIBehaviorComponent in the world.
+ * Registered components have their own tick disabled and are updated grouped by EAIBehaviorType.
+ * Also assigns distance-based LOD tiers to behavior and combat AI components, and
+ * time-slices decision updates across frames under a game-thread millisecond budget.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UAITickManagerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UAITickManagerSubsystem();
+
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ============================================
+	// Configuration
+	// ============================================
+
+	// When false, behavior components keep ticking themselves
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Tick Manager")
+	bool bBatchBehaviorTicks = true;
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Tick Manager|LOD")
+	bool bEnableLOD = true;
+
+	// Indexed by EAILODTier, ordered nearest to farthest
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Tick Manager|LOD")
+	TArray<FAILODTierSettings> LODTiers;
+
+	// How far past a tier boundary an agent must move before switching tiers
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Tick Manager|LOD")
+	float LODHysteresisDistance = 300.0f;
+
+	// Seconds between tier re-evaluations
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Tick Manager|LOD")
+	float LODEvaluationInterval = 0.25f;
+
+	// When false, every due agent updates every frame regardless of cost
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Tick Manager|Scheduler")
+	bool bEnableTimeSlicing = true;
+
+	// Game-thread milliseconds per frame spent on behavior decisions
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Tick Manager|Scheduler")
+	float FrameBudgetMs = 2.0f;
+
+	// Updates always allowed per frame even when over budget
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Tick Manager|Scheduler")
+	int32 MinUpdatesPerFrame = 8;
+
+	// Agents far from every player stop ticking entirely until a player approaches
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Tick Manager|Dormancy")
+	bool bEnableDormancy = true;
+
+	// Dormant agents wake when a player comes this close, and fall asleep
+	// again beyond this plus LODHysteresisDistance
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Tick Manager|Dormancy")
+	float DormancyActivationRadius = 14000.0f;
+
+	// Behavior types allowed to go dormant
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Tick Manager|Dormancy")
+	TArray<EAIBehaviorType> DormantBehaviorTypes;
+
+	// ============================================
+	// Registration
+	// ============================================
+
+	bool RegisterBehavior(UAIBehaviorComponent* Behavior);
+	void UnregisterBehavior(UAIBehaviorComponent* Behavior);
+
+	// Moves a component to the bucket matching its current BehaviorType
+	void RefreshBehaviorType(UAIBehaviorComponent* Behavior);
+
+	// Combat AI keeps its own tick, the manager only drives its LOD tier
+	void RegisterCombatAI(UCombatAIComponent* CombatAI);
+	void UnregisterCombatAI(UCombatAIComponent* CombatAI);
+
+	// ============================================
+	// Queries
+	// ============================================
+
+	UFUNCTION(BlueprintCallable, Category = "AI Tick Manager")
+	int32 GetRegisteredCount(EAIBehaviorType BehaviorType) const;
+
+	UFUNCTION(BlueprintCallable, Category = "AI Tick Manager")
+	int32 GetTotalRegisteredCount() const;
+
+	UFUNCTION(BlueprintCallable, Category = "AI Tick Manager|LOD")
+	int32 GetLODTierCount(EAILODTier Tier) const;
+
+	const FAILODTierSettings& GetLODTierSettings(EAILODTier Tier) const;
+
+	UFUNCTION(BlueprintCallable, Category = "AI Tick Manager|Scheduler")
+	FAISchedulerStats GetSchedulerStats() const { return SchedulerStats; }
+
+	// Seconds since the agent's last behavior decision
+	float GetDecisionStaleness(const UAIBehaviorComponent* Behavior) const;
+
+	UFUNCTION(BlueprintCallable, Category = "AI Tick Manager|Dormancy")
+	int32 GetDormantCount() const { return DormantAgents.Num(); }
+
+	bool IsDormant(const UAIBehaviorComponent* Behavior) const;
+
+	// Wakes a dormant agent immediately, e.g. when it is damaged
+	void WakeAgent(UAIBehaviorComponent* Behavior);
+
+	// Per behavior type decision timing, off by default since it costs two clock reads per update
+	void SetCollectBehaviorTimings(bool bCollect) { bCollectBehaviorTimings = bCollect; }
+	double GetBehaviorUpdateSeconds(EAIBehaviorType Type) const { return BehaviorUpdateSeconds[static_cast<int32>(Type)]; }
+	int32 GetBehaviorUpdateCount(EAIBehaviorType Type) const { return BehaviorUpdateCounts[static_cast<int32>(Type)]; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	static constexpr int32 NumBehaviorTypes = static_cast<int32>(EAIBehaviorType::Aggressive) + 1;
+
+	using FBehaviorUpdateFunction = void (UAIBehaviorComponent::*)(float);
+
+	UPROPERTY()
+	TArray<FAIBehaviorBucket> Buckets;
+
+	// Registration changes requested while buckets are being iterated
+	UPROPERTY()
+	TArray<UAIBehaviorComponent*> PendingRegistrations;
+
+	UPROPERTY()
+	TArray<UAIBehaviorComponent*> PendingTypeChanges;
+
+	UPROPERTY()
+	TArray<UCombatAIComponent*> CombatComponents;
+
+	UPROPERTY()
+	TArray<FAIDormantAgent> DormantAgents;
+
+	TSet<TObjectKey<AActor>> DormantOwners;
+
+	bool bIsTicking = false;
+	bool bHasPendingRemovals = false;
+	float TimeSinceLODEvaluation = 0.0f;
+
+	// Scheduler
+	FAISchedulerCursor PriorityCursor;
+	FAISchedulerCursor RoundRobinCursor;
+	FAISchedulerStats SchedulerStats;
+
+	// Totals since timing collection was enabled
+	bool bCollectBehaviorTimings = false;
+	double BehaviorUpdateSeconds[NumBehaviorTypes] = {};
+	int32 BehaviorUpdateCounts[NumBehaviorTypes] = {};
+
+	void EnsureBuckets();
+	void RunSchedulerPass(bool bPriorityPass, FAISchedulerCursor& Cursor, double Deadline, int32& UpdatedAgents);
+	bool IsHighPriority(const FAIBehaviorHotState& State) const;
+	void UpdateSchedulerStats(int32 UpdatedAgents, float UpdateTimeMs);
+	void AddToBucket(UAIBehaviorComponent* Behavior);
+	void RemoveFromBucket(UAIBehaviorComponent* Behavior);
+	void CompactBuckets();
+	void FlushPendingChanges();
+
+	// LOD
+	void UpdateLODTiers();
+	EAILODTier ComputeLODTier(float Distance, EAILODTier CurrentTier) const;
+	void ApplyBehaviorLOD(UAIBehaviorComponent* Behavior, FAIBehaviorHotState& State, EAILODTier NewTier);
+	void ApplyCombatLOD(UCombatAIComponent* CombatAI, EAILODTier NewTier);
+	static bool IsCombatEngaged(const UCombatAIComponent* CombatAI);
+	static void SetMovementEnabled(AActor* Owner, bool bEnabled);
+
+	// Dormancy
+	bool CanSleep(const UAIBehaviorComponent* Behavior, const FAIBehaviorHotState& State, float DistanceToPlayer) const;
+	void SleepAgent(UAIBehaviorComponent* Behavior);
+	void HandleDormancyRing(FName RingName, AActor* Player, bool bInside, TWeakObjectPtr<UAIBehaviorComponent> Behavior);
+	int32 FindDormantIndex(const UAIBehaviorComponent* Behavior) const;
+	bool IsOwnerDormant(const AActor* Owner) const;
+
+	// Points every component in the bucket at its slot in HotStates
+	static void RebindHotStates(FAIBehaviorBucket& Bucket, int32 FirstIndex = 0);
+};
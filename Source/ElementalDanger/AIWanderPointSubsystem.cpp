@@ -0,0 +1,146 @@
+// AI Wander Point Subsystem Implementation
+
+#include "AIWanderPointSubsystem.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UAIWanderPointSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAIWanderPointSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Rebuilt tiles may have moved or removed pooled points
+	if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+	{
+		NavSystem->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UAIWanderPointSubsystem::HandleNavigationGenerationFinished);
+	}
+}
+
+void UAIWanderPointSubsystem::Deinitialize()
+{
+	if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSystem->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UAIWanderPointSubsystem::HandleNavigationGenerationFinished);
+	}
+
+	Pools.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UAIWanderPointSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAIWanderPointSubsystem, STATGROUP_Tickables);
+}
+
+void UAIWanderPointSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Pools.Num() == 0) return;
+
+	UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSystem) return;
+
+	// Top up pools until the query budget runs out
+	int32 QueriesLeft = MaxQueriesPerFrame;
+	for (auto& Pair : Pools)
+	{
+		FAIWanderPool& Pool = Pair.Value;
+
+		while (Pool.Points.Num() < PointsPerPool && QueriesLeft > 0)
+		{
+			--QueriesLeft;
+
+			FNavLocation NavLocation;
+			if (!NavSystem->GetRandomReachablePointInRadius(Pool.Center, Pool.Radius, NavLocation)) break;
+
+			Pool.Points.Add(NavLocation.Location);
+			Pool.Uses.Add(0);
+		}
+
+		if (QueriesLeft == 0) break;
+	}
+
+	TimeSincePrune += DeltaTime;
+	if (TimeSincePrune >= PoolIdleLifetime)
+	{
+		TimeSincePrune = 0.0f;
+
+		const double Now = GetWorld()->GetTimeSeconds();
+		for (auto It = Pools.CreateIterator(); It; ++It)
+		{
+			if (Now - It.Value().LastUsedTime > PoolIdleLifetime)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+// ============================================
+// Points
+// ============================================
+
+TPair<FIntVector, int32> UAIWanderPointSubsystem::GetPoolKey(const FVector& Origin, float Radius) const
+{
+	const FIntVector Cell(
+		FMath::FloorToInt(Origin.X / PoolCellSize),
+		FMath::FloorToInt(Origin.Y / PoolCellSize),
+		FMath::FloorToInt(Origin.Z / PoolCellSize));
+
+	return TPair<FIntVector, int32>(Cell, FMath::RoundToInt(Radius));
+}
+
+bool UAIWanderPointSubsystem::GetRandomPoint(const FVector& Origin, float Radius, FVector& OutPoint)
+{
+	if (Radius <= 0.0f) return false;
+
+	const TPair<FIntVector, int32> Key = GetPoolKey(Origin, Radius);
+
+	FAIWanderPool* Pool = Pools.Find(Key);
+	if (!Pool)
+	{
+		// Filled over the next frames, this request falls back to the caller
+		Pool = &Pools.Add(Key);
+		Pool->Center = Origin;
+		Pool->Radius = Radius;
+	}
+
+	Pool->LastUsedTime = GetWorld()->GetTimeSeconds();
+	if (Pool->Points.Num() == 0) return false;
+
+	const int32 Index = FMath::RandHelper(Pool->Points.Num());
+	OutPoint = Pool->Points[Index];
+
+	// Retired points are replaced lazily by Tick
+	if (++Pool->Uses[Index] >= MaxUsesPerPoint)
+	{
+		Pool->Points.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		Pool->Uses.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
+
+	return true;
+}
+
+void UAIWanderPointSubsystem::InvalidatePools()
+{
+	for (auto& Pair : Pools)
+	{
+		Pair.Value.Points.Reset();
+		Pair.Value.Uses.Reset();
+	}
+}
+
+void UAIWanderPointSubsystem::HandleNavigationGenerationFinished(ANavigationData* NavData)
+{
+	InvalidatePools();
+}
@@ -0,0 +1,94 @@
+// AI Wander Point Subsystem - Pools of precomputed reachable wander points per spawn area
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AIWanderPointSubsystem.generated.h"
+
+class ANavigationData;
+
+/**
+ * Reachable points around one spawn area or territory
+ */
+struct FAIWanderPool
+{
+	FVector Center = FVector::ZeroVector;
+	float Radius = 0.0f;
+
+	// Index-aligned, points are retired after MaxUsesPerPoint picks
+	TArray<FVector> Points;
+	TArray<uint8> Uses;
+
+	double LastUsedTime = 0.0;
+};
+
+/**
+ * Wander and patrol targets come from small pools of navmesh-validated points instead of
+ * unchecked random offsets. Mobs sharing a spawn area (quantized to PoolCellSize) share a pool,
+ * picking a target is an array lookup, and pools are refilled a few nav queries per frame.
+ * Every pool is emptied when navigation finishes rebuilding so no point outlives its tile.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UAIWanderPointSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ============================================
+	// Configuration
+	// ============================================
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Wander Points")
+	int32 PointsPerPool = 16;
+
+	// Picks before a point is replaced, keeps wandering varied
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Wander Points")
+	int32 MaxUsesPerPoint = 4;
+
+	// Origins in the same cell share a pool
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Wander Points")
+	float PoolCellSize = 500.0f;
+
+	// Navigation queries spent refilling pools per frame
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Wander Points")
+	int32 MaxQueriesPerFrame = 16;
+
+	// Pools nobody picked from for this long are dropped
+	UPROPERTY(Config, BlueprintReadOnly, Category = "AI Wander Points")
+	float PoolIdleLifetime = 60.0f;
+
+	// ============================================
+	// Points
+	// ============================================
+
+	// A reachable point within Radius of Origin, false while the pool is still empty
+	bool GetRandomPoint(const FVector& Origin, float Radius, FVector& OutPoint);
+
+	UFUNCTION(BlueprintCallable, Category = "AI Wander Points")
+	void InvalidatePools();
+
+	UFUNCTION(BlueprintCallable, Category = "AI Wander Points")
+	int32 GetNumPools() const { return Pools.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	TMap<TPair<FIntVector, int32>, FAIWanderPool> Pools;
+
+	float TimeSincePrune = 0.0f;
+
+	UFUNCTION()
+	void HandleNavigationGenerationFinished(ANavigationData* NavData);
+
+	TPair<FIntVector, int32> GetPoolKey(const FVector& Origin, float Radius) const;
+};
@@ -3,6 +3,12 @@
 #include "CombatAIComponent.h"
 #include "CombatEntity.h"
 #include "NinjaWizardCharacter.h"
+#include "AITickManagerSubsystem.h"
+#include "CombatSpatialHashSubsystem.h"
+#include "CombatProjectileSubsystem.h"
+#include "AITargetMotionSubsystem.h"
+#include "AIBehaviorComponent.h"
+#include "AILineOfSightSubsystem.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
@@ -20,7 +26,6 @@ UCombatAIComponent::UCombatAIComponent()
 
 	TimeSinceLastAttack = 0.0f;
 	ComboTimer = 0.0f;
-	AttackCooldownTimer = 0.0f;
 
 	bIsEnraged = false;
 	bIsBlocking = false;
@@ -28,6 +33,7 @@ UCombatAIComponent::UCombatAIComponent()
 
 	CurrentCombo = nullptr;
 	CurrentAttack = nullptr;
+	TickManager = nullptr;
 }
 
 void UCombatAIComponent::BeginPlay()
@@ -35,26 +41,46 @@ void UCombatAIComponent::BeginPlay()
 	Super::BeginPlay();
 
 	OwnerEntity = Cast<ACombatEntity>(GetOwner());
+
+	// LOD tier is driven by the AI tick manager
+	TickManager = GetWorld() ? GetWorld()->GetSubsystem<UAITickManagerSubsystem>() : nullptr;
+	if (TickManager)
+	{
+		TickManager->RegisterCombatAI(this);
+	}
+
+	RegisterHealthThresholds();
+
+	// Spread threat evaluation of mobs spawned together across frames
+	if (GetWorld())
+	{
+		NextThreatEvaluationTime = GetWorld()->GetTimeSeconds() + FMath::FRand() * ThreatEvaluationInterval;
+	}
+}
+
+void UCombatAIComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterHealthThresholds();
+
+	if (TickManager)
+	{
+		TickManager->UnregisterCombatAI(this);
+		TickManager = nullptr;
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UCombatAIComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	AdvanceAttackPhase();
+	UpdateThreat();
 	UpdateCombatAI(DeltaTime);
 
-	// Update cooldown timers
+	// Cooldowns store absolute expiry times, only the attack clock ticks
 	TimeSinceLastAttack += DeltaTime;
-	AttackCooldownTimer = FMath::Max(AttackCooldownTimer - DeltaTime, 0.0f);
-
-	// Update spell cooldowns
-	TArray<FName> Keys;
-	SpellCooldowns.GetKeys(Keys);
-	for (FName Key : Keys)
-	{
-		float& Cooldown = SpellCooldowns[Key];
-		Cooldown = FMath::Max(Cooldown - DeltaTime, 0.0f);
-	}
 
 	// Update combo timer
 	if (bIsInCombo)
@@ -103,11 +129,27 @@ void UCombatAIComponent::StartCombat(AActor* Enemy)
 	CurrentTarget = Enemy;
 	OnCombatStarted(Enemy);
 
-	// Boss phase initialization
+	// Boss phase initialization, later phases follow health threshold crossings
 	if (bIsBoss && BossPhases.Num() > 0)
 	{
 		CurrentBossPhase = 0;
+		UpdateBossPhase();
+	}
+}
+
+void UCombatAIComponent::SwitchTarget(AActor* NewTarget)
+{
+	if (!NewTarget || NewTarget == CurrentTarget) return;
+
+	if (!CurrentTarget)
+	{
+		StartCombat(NewTarget);
+		return;
 	}
+
+	AActor* OldTarget = CurrentTarget;
+	CurrentTarget = NewTarget;
+	OnTargetChanged(OldTarget, NewTarget);
 }
 
 void UCombatAIComponent::EndCombat()
@@ -116,6 +158,11 @@ void UCombatAIComponent::EndCombat()
 	bIsAttacking = false;
 	bIsInCombo = false;
 	CurrentComboStep = 0;
+	AttackPhase = EAIAttackPhase::Idle;
+	SwingTarget = nullptr;
+	ThreatTable.Reset();
+	TauntTarget = nullptr;
+	TauntDuration.Reset();
 	OnCombatEnded();
 }
 
@@ -144,7 +191,7 @@ void UCombatAIComponent::PerformAttack(AActor* Target)
 
 bool UCombatAIComponent::CanAttack() const
 {
-	return !bIsAttacking && AttackCooldownTimer <= 0.0f && !bIsDodging;
+	return !bIsAttacking && !AttackCooldown.IsActive(GetWorld()) && !bIsDodging;
 }
 
 float UCombatAIComponent::GetAttackRange() const
@@ -170,8 +217,12 @@ void UCombatAIComponent::UpdateWarriorAI(float DeltaTime)
 
 	float Distance = GetDistanceToTarget(CurrentTarget);
 
-	// Check combat decisions
-	EvaluateCombatSituation(CurrentTarget);
+	// Check combat decisions (skipped at reduced LOD)
+	const FAILODTierSettings* LOD = GetLODSettings();
+	if (!LOD || LOD->bRunCombatDecisions)
+	{
+		EvaluateCombatSituation(CurrentTarget);
+	}
 
 	// Attack when in range
 	if (Distance <= GetAttackRange())
@@ -231,37 +282,79 @@ void UCombatAIComponent::ExecuteComboAttack(const FAIAttackData& Attack, AActor*
 
 	bIsAttacking = true;
 
-	// Windup time
-	FTimerHandle WindupTimer;
-	GetWorld()->GetTimerManager().SetTimer(WindupTimer, [this, Attack, Target]()
+	// Windup, hit, recovery and combo gap play out in AdvanceAttackPhase
+	SwingAttack = Attack;
+	SwingTarget = Target;
+	AttackPhaseEndTime = GetWorld()->GetTimeSeconds();
+	EnterAttackPhase(EAIAttackPhase::Windup, Attack.WindupTime);
+
+	AttackCooldown.Start(GetWorld(), Attack.Cooldown);
+	TimeSinceLastAttack = 0.0f;
+}
+
+void UCombatAIComponent::EnterAttackPhase(EAIAttackPhase Phase, float Duration)
+{
+	// Chained from the previous deadline so long frames do not stretch the swing
+	AttackPhase = Phase;
+	AttackPhaseEndTime += Duration;
+}
+
+void UCombatAIComponent::AdvanceAttackPhase()
+{
+	if (AttackPhase == EAIAttackPhase::Idle) return;
+
+	// A dead attacker finishes nothing
+	if (!OwnerEntity || !OwnerEntity->IsAlive())
 	{
-		// Deal damage
-		DealDamageToTarget(Target, Attack.Damage);
-		OnAttackExecuted(Attack);
+		AttackPhase = EAIAttackPhase::Idle;
+		bIsAttacking = false;
+		return;
+	}
 
-		// Recovery time
-		FTimerHandle RecoveryTimer;
-		GetWorld()->GetTimerManager().SetTimer(RecoveryTimer, [this]()
+	// Several phases can elapse in one tick at reduced LOD tick rates
+	const double Now = GetWorld()->GetTimeSeconds();
+	while (AttackPhase != EAIAttackPhase::Idle && Now >= AttackPhaseEndTime)
+	{
+		switch (AttackPhase)
 		{
-			bIsAttacking = false;
+			case EAIAttackPhase::Windup:
+				EnterAttackPhase(EAIAttackPhase::Active, 0.0f);
+				break;
 
-			// Continue combo if still in combo state
-			if (bIsInCombo)
-			{
-				float ComboDelay = FMath::RandRange(0.3f, 0.6f);
-				FTimerHandle ComboDelayTimer;
-				GetWorld()->GetTimerManager().SetTimer(ComboDelayTimer, [this]()
+			case EAIAttackPhase::Active:
+				if (AActor* Target = SwingTarget.Get())
 				{
-					ContinueCombo();
-				}, ComboDelay, false);
-			}
+					DealDamageToTarget(Target, SwingAttack.Damage);
+				}
+				OnAttackExecuted(SwingAttack);
+				EnterAttackPhase(EAIAttackPhase::Recovery, SwingAttack.RecoveryTime);
+				break;
 
-		}, Attack.RecoveryTime, false);
+			case EAIAttackPhase::Recovery:
+				bIsAttacking = false;
 
-	}, Attack.WindupTime, false);
+				// Continue combo if still in combo state
+				if (bIsInCombo)
+				{
+					EnterAttackPhase(EAIAttackPhase::ComboGap, FMath::RandRange(0.3f, 0.6f));
+				}
+				else
+				{
+					AttackPhase = EAIAttackPhase::Idle;
+				}
+				break;
 
-	AttackCooldownTimer = Attack.Cooldown;
-	TimeSinceLastAttack = 0.0f;
+			case EAIAttackPhase::ComboGap:
+				// Starts the next swing's windup, or ends the combo
+				AttackPhase = EAIAttackPhase::Idle;
+				ContinueCombo();
+				break;
+
+			default:
+				AttackPhase = EAIAttackPhase::Idle;
+				break;
+		}
+	}
 }
 
 void UCombatAIComponent::SelectRandomCombo()
@@ -305,8 +398,7 @@ void UCombatAIComponent::CastSpell(AActor* Target)
 		bIsAttacking = true;
 
 		// Casting time (windup)
-		FTimerHandle CastTimer;
-		GetWorld()->GetTimerManager().SetTimer(CastTimer, [this, Target]()
+		GetWorld()->GetTimerManager().SetTimer(AttackTimerHandle, [this, Target]()
 		{
 			if (CurrentAttack->bIsRanged)
 			{
@@ -320,13 +412,13 @@ void UCombatAIComponent::CastSpell(AActor* Target)
 			OnSpellCast(*CurrentAttack);
 
 			// Set spell on cooldown
-			SpellCooldowns.Add(CurrentAttack->AttackName, CurrentAttack->Cooldown);
+			SpellCooldowns.Start(GetSpellSlot(*CurrentAttack), GetWorld(), CurrentAttack->Cooldown);
 
 			bIsAttacking = false;
 
 		}, CurrentAttack->WindupTime, false);
 
-		AttackCooldownTimer = 1.0f; // Global cooldown between casts
+		AttackCooldown.Start(GetWorld(), 1.0f); // Global cooldown between casts
 	}
 }
 
@@ -353,15 +445,32 @@ void UCombatAIComponent::SelectBestSpell(AActor* Target)
 
 void UCombatAIComponent::SpawnProjectile(const FAIAttackData& Spell, AActor* Target)
 {
-	if (!Spell.ProjectileClass || !OwnerEntity || !Target) return;
+	if (!OwnerEntity || !Target || !GetWorld()) return;
 
 	FVector SpawnLocation = OwnerEntity->GetActorLocation() + (OwnerEntity->GetActorForwardVector() * 100.0f);
-	FVector TargetLocation = PredictTargetLocation(Target, 1000.0f); // Projectile speed
-	FRotator SpawnRotation = (TargetLocation - SpawnLocation).Rotation();
+	FVector TargetLocation = PredictTargetLocation(Target, Spell.ProjectileSpeed);
+
+	// Simulated as data, the projectile class is only pooled for visuals
+	if (UCombatProjectileSubsystem* Projectiles = GetWorld()->GetSubsystem<UCombatProjectileSubsystem>())
+	{
+		FCombatProjectileParams Params;
+		Params.Speed = Spell.ProjectileSpeed;
+		Params.Damage = Spell.Damage;
+		Params.Element = Spell.ElementType;
+		Params.CosmeticClass = Spell.ProjectileClass;
+
+		Projectiles->LaunchProjectile(SpawnLocation, TargetLocation - SpawnLocation, Params, OwnerEntity);
+		return;
+	}
+
+	if (!Spell.ProjectileClass) return;
 
-	AActor* Projectile = GetWorld()->SpawnActor<AActor>(Spell.ProjectileClass, SpawnLocation, SpawnRotation);
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.Owner = OwnerEntity;
+	SpawnParams.Instigator = OwnerEntity;
 
-	// TODO: Set projectile damage and owner
+	FRotator SpawnRotation = (TargetLocation - SpawnLocation).Rotation();
+	GetWorld()->SpawnActor<AActor>(Spell.ProjectileClass, SpawnLocation, SpawnRotation, SpawnParams);
 }
 
 void UCombatAIComponent::CastAreaOfEffectSpell(const FAIAttackData& Spell)
@@ -372,30 +481,167 @@ void UCombatAIComponent::CastAreaOfEffectSpell(const FAIAttackData& Spell)
 	FVector AOECenter = CurrentTarget ? CurrentTarget->GetActorLocation() : OwnerEntity->GetActorLocation();
 
 	// Deal damage to all nearby enemies
-	TArray<FHitResult> HitResults;
-	FCollisionShape Sphere = FCollisionShape::MakeSphere(Spell.Range);
-	GetWorld()->SweepMultiByChannel(HitResults, AOECenter, AOECenter, FQuat::Identity,
-		ECC_Pawn, Sphere);
+	TArray<AActor*> HitActors;
+	QueryAreaOfEffectTargets(AOECenter, Spell.Range, HitActors);
+
+	for (AActor* HitActor : HitActors)
+	{
+		DealDamageToTarget(HitActor, Spell.Damage);
+	}
+}
+
+bool UCombatAIComponent::IsSpellOnCooldown(const FAIAttackData& Spell) const
+{
+	return SpellCooldowns.IsActive(GetSpellSlot(Spell), GetWorld());
+}
 
-	for (const FHitResult& Hit : HitResults)
+int32 UCombatAIComponent::GetSpellSlot(const FAIAttackData& Spell) const
+{
+	const FAIAttackData* Spells = MagicSpells.GetData();
+	if (&Spell >= Spells && &Spell < Spells + MagicSpells.Num())
 	{
-		if (AActor* HitActor = Hit.GetActor())
+		return static_cast<int32>(&Spell - Spells);
+	}
+
+	return MagicSpells.IndexOfByPredicate([&Spell](const FAIAttackData& Entry) { return Entry.AttackName == Spell.AttackName; });
+}
+
+// ============================================
+// Threat
+// ============================================
+
+void UCombatAIComponent::AddThreat(AActor* Source, float Amount)
+{
+	if (!Source || Source == GetOwner() || !GetWorld()) return;
+
+	ThreatTable.AddThreat(Source, Amount, GetWorld()->GetTimeSeconds());
+}
+
+void UCombatAIComponent::NotifyDamagedBy(AActor* DamageDealer, float Damage)
+{
+	AddThreat(DamageDealer, Damage * DamageThreatMultiplier);
+}
+
+void UCombatAIComponent::Taunt(AActor* Taunter, float Duration)
+{
+	if (!Taunter || !GetWorld()) return;
+
+	// Matching the top threat keeps the taunter on top once the taunt wears off
+	const double Now = GetWorld()->GetTimeSeconds();
+	const float TopThreat = ThreatTable.GetThreat(ThreatTable.GetTopTarget(Now), Now);
+	AddThreat(Taunter, FMath::Max(TopThreat - ThreatTable.GetThreat(Taunter, Now), ThreatTable.MinThreat));
+
+	TauntTarget = Taunter;
+	TauntDuration.Start(GetWorld(), Duration);
+
+	// Retarget on the next tick
+	NextThreatEvaluationTime = 0.0;
+}
+
+float UCombatAIComponent::GetThreat(AActor* Source) const
+{
+	return GetWorld() ? ThreatTable.GetThreat(Source, GetWorld()->GetTimeSeconds()) : 0.0f;
+}
+
+void UCombatAIComponent::GetTopThreats(int32 Count, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset();
+	if (!GetWorld()) return;
+
+	ThreatTable.GetTopTargets(Count, GetWorld()->GetTimeSeconds(), OutActors);
+}
+
+void UCombatAIComponent::UpdateThreat()
+{
+	if (!GetWorld() || !OwnerEntity) return;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (Now < NextThreatEvaluationTime) return;
+	NextThreatEvaluationTime = Now + ThreatEvaluationInterval;
+
+	ThreatTable.MaxEntries = MaxThreatEntries;
+	ThreatTable.DecayRate = ThreatDecayRate;
+
+	AddProximityThreat(Now);
+
+	AActor* NewTarget = nullptr;
+	if (TauntDuration.IsActive(GetWorld()) && IsThreatTargetAlive(TauntTarget.Get()))
+	{
+		NewTarget = TauntTarget.Get();
+	}
+	else
+	{
+		// Dead targets are only noticed when they reach the top
+		NewTarget = ThreatTable.GetTopTarget(Now);
+		while (NewTarget && !IsThreatTargetAlive(NewTarget))
 		{
-			if (HitActor != OwnerEntity)
-			{
-				DealDamageToTarget(HitActor, Spell.Damage);
-			}
+			ThreatTable.Remove(NewTarget);
+			NewTarget = ThreatTable.GetTopTarget(Now);
+		}
+
+		// Keeps two similar threats from swapping the target every evaluation
+		if (NewTarget && CurrentTarget && NewTarget != CurrentTarget && IsThreatTargetAlive(CurrentTarget) &&
+			ThreatTable.GetThreat(NewTarget, Now) < ThreatTable.GetThreat(CurrentTarget, Now) * TargetSwitchThreshold)
+		{
+			NewTarget = CurrentTarget;
 		}
 	}
+
+	// Threat only picks a first target when allowed to, Blueprint starts combat otherwise
+	if (!NewTarget || (!CurrentTarget && !bEngageOnThreat)) return;
+
+	SwitchTarget(NewTarget);
 }
 
-bool UCombatAIComponent::IsSpellOnCooldown(const FAIAttackData& Spell) const
+void UCombatAIComponent::AddProximityThreat(double Now)
+{
+	if (ProximityThreatPerSecond <= 0.0f || ProximityThreatRadius <= 0.0f) return;
+
+	// Out of combat, proximity may only build threat on mobs allowed to start a fight from it
+	if (!CurrentTarget)
+	{
+		if (!bEngageOnThreat) return;
+
+		const UAIBehaviorComponent* Behavior = OwnerEntity->FindComponentByClass<UAIBehaviorComponent>();
+		if (Behavior && (Behavior->BehaviorType == EAIBehaviorType::Passive || Behavior->BehaviorType == EAIBehaviorType::Neutral)) return;
+	}
+
+	UCombatSpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHashSubsystem>();
+	if (!SpatialHash) return;
+
+	// Summons resent enemies, everyone else resents players and their summons
+	const bool bIsSummon = OwnerEntity->bIsPlayerSummon;
+	FCombatEntityQueryFilter Filter;
+	Filter.bIncludeEnemies = bIsSummon;
+	Filter.bIncludeSummons = !bIsSummon;
+	Filter.bIncludePlayers = !bIsSummon;
+	Filter.IgnoredActor = OwnerEntity;
+
+	const FVector Origin = OwnerEntity->GetActorLocation();
+	TArray<AActor*> NearbyActors;
+	SpatialHash->QuerySphere(Origin, ProximityThreatRadius, Filter, NearbyActors);
+
+	const float ThreatPerEvaluation = ProximityThreatPerSecond * ThreatEvaluationInterval;
+	for (AActor* Actor : NearbyActors)
+	{
+		const float Closeness = 1.0f - FVector::Dist(Origin, Actor->GetActorLocation()) / ProximityThreatRadius;
+		ThreatTable.AddThreat(Actor, ThreatPerEvaluation * FMath::Max(Closeness, 0.0f), Now);
+	}
+}
+
+bool UCombatAIComponent::IsThreatTargetAlive(const AActor* Target)
 {
-	if (SpellCooldowns.Contains(Spell.AttackName))
+	if (!IsValid(Target)) return false;
+
+	if (const ACombatEntity* Entity = Cast<ACombatEntity>(Target))
+	{
+		return Entity->IsAlive();
+	}
+	if (const ANinjaWizardCharacter* Player = Cast<ANinjaWizardCharacter>(Target))
 	{
-		return SpellCooldowns[Spell.AttackName] > 0.0f;
+		return !Player->IsDead();
 	}
-	return false;
+	return true;
 }
 
 // ============================================
@@ -428,8 +674,7 @@ void UCombatAIComponent::FireArrow(AActor* Target)
 	bIsAttacking = true;
 
 	// Draw bow (windup)
-	FTimerHandle DrawTimer;
-	GetWorld()->GetTimerManager().SetTimer(DrawTimer, [this, Arrow, Target]()
+	GetWorld()->GetTimerManager().SetTimer(AttackTimerHandle, [this, Arrow, Target]()
 	{
 		SpawnProjectile(Arrow, Target);
 		OnAttackExecuted(Arrow);
@@ -438,7 +683,7 @@ void UCombatAIComponent::FireArrow(AActor* Target)
 
 	}, Arrow.WindupTime, false);
 
-	AttackCooldownTimer = Arrow.Cooldown;
+	AttackCooldown.Start(GetWorld(), Arrow.Cooldown);
 }
 
 void UCombatAIComponent::ChargeShot(AActor* Target)
@@ -488,9 +733,6 @@ void UCombatAIComponent::UpdateBossAI(float DeltaTime)
 {
 	if (!OwnerEntity || !CurrentTarget) return;
 
-	// Update boss phase based on health
-	UpdateBossPhase();
-
 	// Execute attack patterns
 	if (CanAttack())
 	{
@@ -532,6 +774,98 @@ void UCombatAIComponent::UpdateBossPhase()
 	}
 }
 
+void UCombatAIComponent::RegisterHealthThresholds()
+{
+	if (!OwnerEntity) return;
+
+	if (bIsBoss)
+	{
+		TArray<float, TInlineAllocator<8>> PhaseThresholds;
+		for (const FBossPhaseData& Phase : BossPhases)
+		{
+			PhaseThresholds.AddUnique(Phase.HealthThreshold);
+		}
+
+		for (float Threshold : PhaseThresholds)
+		{
+			HealthThresholdHandles.Add(OwnerEntity->RegisterHealthThreshold(Threshold,
+				FHealthThresholdDelegate::CreateUObject(this, &UCombatAIComponent::HandleBossPhaseThreshold)));
+		}
+	}
+
+	if (EnrageHealthThreshold > 0.0f)
+	{
+		HealthThresholdHandles.Add(OwnerEntity->RegisterHealthThreshold(EnrageHealthThreshold,
+			FHealthThresholdDelegate::CreateUObject(this, &UCombatAIComponent::HandleEnrageThreshold)));
+	}
+}
+
+void UCombatAIComponent::SetBossPhases(const TArray<FBossPhaseData>& NewBossPhases)
+{
+	BossPhases = NewBossPhases;
+	RefreshHealthThresholds();
+}
+
+void UCombatAIComponent::SetIsBoss(bool bNewIsBoss)
+{
+	bIsBoss = bNewIsBoss;
+	RefreshHealthThresholds();
+}
+
+void UCombatAIComponent::SetEnrageHealthThreshold(float NewThreshold)
+{
+	EnrageHealthThreshold = NewThreshold;
+	RefreshHealthThresholds();
+}
+
+void UCombatAIComponent::RefreshHealthThresholds()
+{
+	// Before BeginPlay the settings are picked up by the first registration
+	if (!HasBegunPlay() || !OwnerEntity) return;
+
+	UnregisterHealthThresholds();
+	RegisterHealthThresholds();
+
+	// Observers only report crossings, so thresholds already passed are applied here
+	if (CurrentTarget)
+	{
+		UpdateBossPhase();
+	}
+	if (EnrageHealthThreshold > 0.0f && !bIsEnraged && OwnerEntity->GetHealthPercentage() <= EnrageHealthThreshold)
+	{
+		EnterEnragedMode();
+	}
+}
+
+void UCombatAIComponent::UnregisterHealthThresholds()
+{
+	if (OwnerEntity)
+	{
+		for (int32 Handle : HealthThresholdHandles)
+		{
+			OwnerEntity->UnregisterHealthThreshold(Handle);
+		}
+	}
+	HealthThresholdHandles.Reset();
+}
+
+void UCombatAIComponent::HandleBossPhaseThreshold(float Threshold, bool bFellBelow)
+{
+	// Out of combat the phase is picked up again by StartCombat
+	if (CurrentTarget)
+	{
+		UpdateBossPhase();
+	}
+}
+
+void UCombatAIComponent::HandleEnrageThreshold(float Threshold, bool bFellBelow)
+{
+	if (bFellBelow && !bIsEnraged)
+	{
+		EnterEnragedMode();
+	}
+}
+
 void UCombatAIComponent::ExecuteBossPattern(EBossAttackPattern Pattern, AActor* Target)
 {
 	if (!Target) return;
@@ -578,33 +912,22 @@ void UCombatAIComponent::PerformAreaOfEffectAttack(AActor* Target)
 	bIsAttacking = true;
 
 	// Windup animation
-	FTimerHandle AOETimer;
-	GetWorld()->GetTimerManager().SetTimer(AOETimer, [this]()
+	GetWorld()->GetTimerManager().SetTimer(AttackTimerHandle, [this]()
 	{
 		// Deal damage in radius around boss
-		TArray<FHitResult> HitResults;
-		FVector Location = OwnerEntity->GetActorLocation();
-		FCollisionShape Sphere = FCollisionShape::MakeSphere(500.0f); // AOE radius
-
-		GetWorld()->SweepMultiByChannel(HitResults, Location, Location, FQuat::Identity,
-			ECC_Pawn, Sphere);
+		TArray<AActor*> HitActors;
+		QueryAreaOfEffectTargets(OwnerEntity->GetActorLocation(), 500.0f, HitActors); // AOE radius
 
-		for (const FHitResult& Hit : HitResults)
+		for (AActor* HitActor : HitActors)
 		{
-			if (AActor* HitActor = Hit.GetActor())
-			{
-				if (HitActor != OwnerEntity)
-				{
-					DealDamageToTarget(HitActor, OwnerEntity->BaseDamage * 1.5f);
-				}
-			}
+			DealDamageToTarget(HitActor, OwnerEntity->BaseDamage * 1.5f);
 		}
 
 		bIsAttacking = false;
 
 	}, 1.5f, false); // 1.5 second windup
 
-	AttackCooldownTimer = 5.0f; // Long cooldown for powerful attack
+	AttackCooldown.Start(GetWorld(), 5.0f); // Long cooldown for powerful attack
 }
 
 void UCombatAIComponent::PerformChargeAttack(AActor* Target)
@@ -620,7 +943,7 @@ void UCombatAIComponent::PerformChargeAttack(AActor* Target)
 	// TODO: Implement charge movement
 	// Launch character towards target
 
-	AttackCooldownTimer = 3.0f;
+	AttackCooldown.Start(GetWorld(), 3.0f);
 	bIsAttacking = false;
 }
 
@@ -639,7 +962,7 @@ void UCombatAIComponent::SummonMinions()
 		GetWorld()->SpawnActor<AActor>(CurrentPhase.MinionClass, SpawnLocation, FRotator::ZeroRotator);
 	}
 
-	AttackCooldownTimer = 10.0f; // Long cooldown
+	AttackCooldown.Start(GetWorld(), 10.0f); // Long cooldown
 }
 
 void UCombatAIComponent::EnterEnragedMode()
@@ -669,7 +992,7 @@ void UCombatAIComponent::PerformTeleportStrike(AActor* Target)
 	// Immediate attack after teleport
 	DealDamageToTarget(Target, OwnerEntity->BaseDamage * 2.0f);
 
-	AttackCooldownTimer = 4.0f;
+	AttackCooldown.Start(GetWorld(), 4.0f);
 }
 
 void UCombatAIComponent::PerformGroundSlam(AActor* Target)
@@ -679,15 +1002,14 @@ void UCombatAIComponent::PerformGroundSlam(AActor* Target)
 	// Jump up then slam down dealing AOE damage
 	bIsAttacking = true;
 
-	FTimerHandle SlamTimer;
-	GetWorld()->GetTimerManager().SetTimer(SlamTimer, [this]()
+	GetWorld()->GetTimerManager().SetTimer(AttackTimerHandle, [this]()
 	{
 		PerformAreaOfEffectAttack(CurrentTarget);
 		bIsAttacking = false;
 
 	}, 1.0f, false);
 
-	AttackCooldownTimer = 6.0f;
+	AttackCooldown.Start(GetWorld(), 6.0f);
 }
 
 void UCombatAIComponent::PerformRangedBarrage(AActor* Target)
@@ -695,10 +1017,9 @@ void UCombatAIComponent::PerformRangedBarrage(AActor* Target)
 	if (!Target || !OwnerEntity) return;
 
 	// Fire multiple projectiles in quick succession
-	for (int32 i = 0; i < 5; i++)
+	for (int32 i = 0; i < UE_ARRAY_COUNT(BarrageTimerHandles); i++)
 	{
-		FTimerHandle BarrageTimer;
-		GetWorld()->GetTimerManager().SetTimer(BarrageTimer, [this, Target, i]()
+		GetWorld()->GetTimerManager().SetTimer(BarrageTimerHandles[i], [this, Target, i]()
 		{
 			if (RangedAttacks.Num() > 0)
 			{
@@ -708,7 +1029,7 @@ void UCombatAIComponent::PerformRangedBarrage(AActor* Target)
 		}, i * 0.3f, false); // 0.3 second intervals
 	}
 
-	AttackCooldownTimer = 8.0f;
+	AttackCooldown.Start(GetWorld(), 8.0f);
 }
 
 void UCombatAIComponent::EnterDefensiveStance()
@@ -722,8 +1043,7 @@ void UCombatAIComponent::EnterDefensiveStance()
 	}
 
 	// Exit defensive stance after duration
-	FTimerHandle DefenseTimer;
-	GetWorld()->GetTimerManager().SetTimer(DefenseTimer, [this]()
+	GetWorld()->GetTimerManager().SetTimer(DefenseTimerHandle, [this]()
 	{
 		bIsBlocking = false;
 		if (OwnerEntity)
@@ -733,7 +1053,7 @@ void UCombatAIComponent::EnterDefensiveStance()
 
 	}, 5.0f, false);
 
-	AttackCooldownTimer = 10.0f;
+	AttackCooldown.Start(GetWorld(), 10.0f);
 }
 
 void UCombatAIComponent::PerformElementalBurst(AActor* Target)
@@ -742,7 +1062,7 @@ void UCombatAIComponent::PerformElementalBurst(AActor* Target)
 	if (!OwnerEntity) return;
 
 	PerformAreaOfEffectAttack(Target);
-	AttackCooldownTimer = 12.0f;
+	AttackCooldown.Start(GetWorld(), 12.0f);
 }
 
 void UCombatAIComponent::SelectRandomBossPattern()
@@ -813,8 +1133,7 @@ void UCombatAIComponent::PerformDodge(FVector DodgeDirection)
 	FVector DodgeLocation = OwnerEntity->GetActorLocation() + (DodgeDirection * 300.0f);
 	OwnerEntity->SetActorLocation(DodgeLocation);
 
-	FTimerHandle DodgeTimer;
-	GetWorld()->GetTimerManager().SetTimer(DodgeTimer, [this]()
+	GetWorld()->GetTimerManager().SetTimer(DodgeTimerHandle, [this]()
 	{
 		bIsDodging = false;
 	}, 0.5f, false);
@@ -824,8 +1143,7 @@ void UCombatAIComponent::PerformBlock()
 {
 	bIsBlocking = true;
 
-	FTimerHandle BlockTimer;
-	GetWorld()->GetTimerManager().SetTimer(BlockTimer, [this]()
+	GetWorld()->GetTimerManager().SetTimer(BlockTimerHandle, [this]()
 	{
 		bIsBlocking = false;
 	}, 2.0f, false);
@@ -859,15 +1177,14 @@ bool UCombatAIComponent::IsTargetInRange(AActor* Target, float Range) const
 
 FVector UCombatAIComponent::PredictTargetLocation(AActor* Target, float ProjectileSpeed) const
 {
-	if (!Target || !OwnerEntity) return Target->GetActorLocation();
+	if (!Target) return FVector::ZeroVector;
+	if (!OwnerEntity) return Target->GetActorLocation();
 
-	// Simple prediction based on target velocity
-	// TODO: Get actual velocity from target
-	FVector TargetVelocity = FVector::ZeroVector;
-	float Distance = GetDistanceToTarget(Target);
-	float TimeToReach = Distance / ProjectileSpeed;
+	// Velocity comes from the shared motion history, sampled once per frame for every shooter
+	UAITargetMotionSubsystem* TargetMotion = GetWorld() ? GetWorld()->GetSubsystem<UAITargetMotionSubsystem>() : nullptr;
+	if (!TargetMotion) return Target->GetActorLocation();
 
-	return Target->GetActorLocation() + (TargetVelocity * TimeToReach);
+	return TargetMotion->PredictInterceptLocation(OwnerEntity->GetActorLocation(), Target, ProjectileSpeed);
 }
 
 void UCombatAIComponent::RotateTowardsTarget(AActor* Target, float DeltaTime)
@@ -895,10 +1212,39 @@ void UCombatAIComponent::DealDamageToTarget(AActor* Target, float Damage)
 	}
 }
 
+void UCombatAIComponent::QueryAreaOfEffectTargets(const FVector& Center, float Radius, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset();
+
+	UCombatSpatialHashSubsystem* SpatialHash = GetWorld() ? GetWorld()->GetSubsystem<UCombatSpatialHashSubsystem>() : nullptr;
+	if (!SpatialHash) return;
+
+	// Everything that used to answer an ECC_Pawn sweep: entities, summons and players
+	FCombatEntityQueryFilter Filter;
+	Filter.bIncludePlayers = true;
+	Filter.IgnoredActor = OwnerEntity;
+
+	SpatialHash->QuerySphere(Center, Radius, Filter, OutActors);
+}
+
 bool UCombatAIComponent::HasLineOfSight(AActor* Target) const
 {
 	if (!Target || !OwnerEntity) return false;
 
+	// Batched async traces with cached results when the service is available. Not gated by LOD,
+	// agents fighting summons far from every player still need to see their target.
+	if (UAILineOfSightSubsystem* LineOfSight = GetWorld()->GetSubsystem<UAILineOfSightSubsystem>())
+	{
+		return LineOfSight->HasLineOfSight(OwnerEntity, Target);
+	}
+
+	// Far from every player the last result for this target stands in for a new trace
+	const FAILODTierSettings* LOD = GetLODSettings();
+	if (LOD && !LOD->bAllowTraces && LastLineOfSightTarget == Target)
+	{
+		return bLastLineOfSight;
+	}
+
 	FHitResult HitResult;
 	FVector Start = OwnerEntity->GetActorLocation();
 	FVector End = Target->GetActorLocation();
@@ -908,5 +1254,55 @@ bool UCombatAIComponent::HasLineOfSight(AActor* Target) const
 
 	bool bHit = GetWorld()->LineTraceSingleByChannel(HitResult, Start, End, ECC_Visibility, QueryParams);
 
-	return !bHit || HitResult.GetActor() == Target;
+	LastLineOfSightTarget = Target;
+	bLastLineOfSight = !bHit || HitResult.GetActor() == Target;
+	return bLastLineOfSight;
+}
+
+void UCombatAIComponent::SetTimersPaused(bool bPaused)
+{
+	if (!GetWorld()) return;
+
+	// The swing and any running cooldowns resume where they left off
+	if (bPaused)
+	{
+		TimersPausedTime = GetWorld()->GetTimeSeconds();
+	}
+	else
+	{
+		const double PausedDuration = GetWorld()->GetTimeSeconds() - TimersPausedTime;
+		if (AttackPhase != EAIAttackPhase::Idle)
+		{
+			AttackPhaseEndTime += PausedDuration;
+		}
+		AttackCooldown.ShiftPaused(TimersPausedTime, PausedDuration);
+		SpellCooldowns.ShiftPaused(TimersPausedTime, PausedDuration);
+	}
+
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	auto SetPaused = [&TimerManager, bPaused](FTimerHandle& Handle)
+	{
+		if (bPaused)
+		{
+			TimerManager.PauseTimer(Handle);
+		}
+		else
+		{
+			TimerManager.UnPauseTimer(Handle);
+		}
+	};
+
+	for (FTimerHandle* Handle : { &AttackTimerHandle, &DefenseTimerHandle, &DodgeTimerHandle, &BlockTimerHandle })
+	{
+		SetPaused(*Handle);
+	}
+	for (FTimerHandle& Handle : BarrageTimerHandles)
+	{
+		SetPaused(Handle);
+	}
+}
+
+const FAILODTierSettings* UCombatAIComponent::GetLODSettings() const
+{
+	return TickManager ? &TickManager->GetLODTierSettings(LODTier) : nullptr;
 }
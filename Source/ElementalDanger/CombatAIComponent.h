@@ -5,10 +5,13 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "AIBehaviorTypes.h"
+#include "CooldownTypes.h"
+#include "AIThreatTable.h"
 #include "CombatAIComponent.generated.h"
 
 class ACombatEntity;
 class ANinjaWizardCharacter;
+class UAITickManagerSubsystem;
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class ELEMENTALDANGER_API UCombatAIComponent : public UActorComponent
@@ -20,6 +23,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -40,12 +44,50 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat AI|Archer")
 	TArray<FAIAttackData> RangedAttacks;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat AI|Boss")
+	// Phases, bIsBoss and the enrage threshold become health threshold observers at BeginPlay.
+	// Blueprint writes go through the setters, C++ changing them after BeginPlay calls the setters
+	// or RefreshHealthThresholds.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetBossPhases, Category = "Combat AI|Boss")
 	TArray<FBossPhaseData> BossPhases;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat AI|Boss")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetIsBoss, Category = "Combat AI|Boss")
 	bool bIsBoss = false;
 
+	// Health fraction at which the boss enrages on its own, 0 leaves enrage to attack patterns
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetEnrageHealthThreshold, Category = "Combat AI|Boss")
+	float EnrageHealthThreshold = 0.0f;
+
+	// Most actors the threat table remembers, the weakest is forgotten first
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat AI|Threat")
+	int32 MaxThreatEntries = 32;
+
+	// Exponential threat decay per second
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat AI|Threat")
+	float ThreatDecayRate = 0.1f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat AI|Threat")
+	float DamageThreatMultiplier = 1.0f;
+
+	// Hostiles inside this radius build threat over time, more when closer
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat AI|Threat")
+	float ProximityThreatRadius = 800.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat AI|Threat")
+	float ProximityThreatPerSecond = 5.0f;
+
+	// Seconds between proximity updates and target re-evaluation
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat AI|Threat")
+	float ThreatEvaluationInterval = 0.5f;
+
+	// A new target must out-threaten the current one by this factor
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat AI|Threat")
+	float TargetSwitchThreshold = 1.1f;
+
+	// Start combat with the top threat when not already fighting. Passive and Neutral mobs
+	// still only engage from damage or taunts, never from proximity.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat AI|Threat")
+	bool bEngageOnThreat = false;
+
 	// ============================================
 	// Combat State
 	// ============================================
@@ -59,9 +101,19 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Combat AI")
 	int32 CurrentComboStep = 0;
 
+	UPROPERTY(BlueprintReadOnly, Category = "Combat AI")
+	EAIAttackPhase AttackPhase = EAIAttackPhase::Idle;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Combat AI|Boss")
 	int32 CurrentBossPhase = 0;
 
+	// Assigned by UAITickManagerSubsystem from distance to the nearest player
+	UPROPERTY(BlueprintReadOnly, Category = "Combat AI|LOD")
+	EAILODTier LODTier = EAILODTier::Full;
+
+	// Holds windup, barrage, stance and dodge timers while the owner is dormant
+	void SetTimersPaused(bool bPaused);
+
 	// ============================================
 	// Combat Actions
 	// ============================================
@@ -72,6 +124,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Combat AI")
 	void EndCombat();
 
+	// Starts combat with NewTarget, or switches to it when already fighting
+	UFUNCTION(BlueprintCallable, Category = "Combat AI")
+	void SwitchTarget(AActor* NewTarget);
+
 	UFUNCTION(BlueprintCallable, Category = "Combat AI")
 	void PerformAttack(AActor* Target);
 
@@ -145,6 +201,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Combat AI|Boss")
 	void UpdateBossPhase();
 
+	UFUNCTION(BlueprintSetter)
+	void SetBossPhases(const TArray<FBossPhaseData>& NewBossPhases);
+
+	UFUNCTION(BlueprintSetter)
+	void SetIsBoss(bool bNewIsBoss);
+
+	UFUNCTION(BlueprintSetter)
+	void SetEnrageHealthThreshold(float NewThreshold);
+
+	// Re-registers the phase and enrage health thresholds from the current settings and applies
+	// any phase or enrage the owner's health has already reached
+	UFUNCTION(BlueprintCallable, Category = "Combat AI|Boss")
+	void RefreshHealthThresholds();
+
 	UFUNCTION(BlueprintCallable, Category = "Combat AI|Boss")
 	void ExecuteBossPattern(EBossAttackPattern Pattern, AActor* Target);
 
@@ -178,6 +248,29 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Combat AI|Boss")
 	void SelectRandomBossPattern();
 
+	// ============================================
+	// Threat
+	// ============================================
+
+	UFUNCTION(BlueprintCallable, Category = "Combat AI|Threat")
+	void AddThreat(AActor* Source, float Amount);
+
+	// Called when the owner takes damage
+	void NotifyDamagedBy(AActor* DamageDealer, float Damage);
+
+	// Forces Taunter as the target for Duration seconds and raises its threat to the top
+	UFUNCTION(BlueprintCallable, Category = "Combat AI|Threat")
+	void Taunt(AActor* Taunter, float Duration);
+
+	UFUNCTION(BlueprintCallable, Category = "Combat AI|Threat")
+	float GetThreat(AActor* Source) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Combat AI|Threat")
+	void GetTopThreats(int32 Count, TArray<AActor*>& OutActors) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Combat AI")
+	AActor* GetCurrentTarget() const { return CurrentTarget; }
+
 	// ============================================
 	// Combat Decision Making
 	// ============================================
@@ -229,6 +322,9 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Combat AI|Events")
 	void OnCombatEnded();
 
+	UFUNCTION(BlueprintImplementableEvent, Category = "Combat AI|Events")
+	void OnTargetChanged(AActor* OldTarget, AActor* NewTarget);
+
 	UFUNCTION(BlueprintImplementableEvent, Category = "Combat AI|Events")
 	void OnAttackExecuted(const FAIAttackData& Attack);
 
@@ -255,6 +351,9 @@ protected:
 	UPROPERTY()
 	AActor* CurrentTarget;
 
+	UPROPERTY()
+	UAITickManagerSubsystem* TickManager;
+
 	// Combat state tracking
 	FMeleeComboChain* CurrentCombo;
 	FAIAttackData* CurrentAttack;
@@ -262,18 +361,41 @@ protected:
 
 	float TimeSinceLastAttack;
 	float ComboTimer;
-	float AttackCooldownTimer;
+
+	// Global cooldown between attacks
+	FCooldown AttackCooldown;
 
 	bool bIsEnraged;
 	bool bIsBlocking;
 	bool bIsDodging;
 
-	TMap<FName, float> SpellCooldowns;
+	// Indexed like MagicSpells
+	FCooldownTable SpellCooldowns;
+
+	// Slot of Spell in MagicSpells, matched by name when Spell is a copy
+	int32 GetSpellSlot(const FAIAttackData& Spell) const;
 
-	// Timers
+	FAIThreatTable ThreatTable;
+	TWeakObjectPtr<AActor> TauntTarget;
+	FCooldown TauntDuration;
+	double NextThreatEvaluationTime = 0.0;
+
+	// Melee swing in progress, advanced every tick against world-time deadlines
+	UPROPERTY()
+	FAIAttackData SwingAttack;
+
+	TWeakObjectPtr<AActor> SwingTarget;
+	double AttackPhaseEndTime = 0.0;
+
+	// World time timers were paused at, deadlines are shifted by the pause on resume
+	double TimersPausedTime = 0.0;
+
+	// Timers, kept so dormancy can pause them
 	FTimerHandle AttackTimerHandle;
-	FTimerHandle ComboTimerHandle;
-	FTimerHandle PatternTimerHandle;
+	FTimerHandle BarrageTimerHandles[5];
+	FTimerHandle DefenseTimerHandle;
+	FTimerHandle DodgeTimerHandle;
+	FTimerHandle BlockTimerHandle;
 
 	// Helper functions
 	void UpdateCombatAI(float DeltaTime);
@@ -282,6 +404,29 @@ protected:
 	void UpdateArcherAI(float DeltaTime);
 	void UpdateBossAI(float DeltaTime);
 
+	// Handles of the owner's health thresholds registered for boss phases and enrage
+	TArray<int32> HealthThresholdHandles;
+
+	void RegisterHealthThresholds();
+	void UnregisterHealthThresholds();
+	void HandleBossPhaseThreshold(float Threshold, bool bFellBelow);
+	void HandleEnrageThreshold(float Threshold, bool bFellBelow);
+
+	// Adds proximity threat and retargets, at most once per ThreatEvaluationInterval
+	void UpdateThreat();
+	void AddProximityThreat(double Now);
+	static bool IsThreatTargetAlive(const AActor* Target);
+
+	void AdvanceAttackPhase();
+	void EnterAttackPhase(EAIAttackPhase Phase, float Duration);
+
 	void DealDamageToTarget(AActor* Target, float Damage);
 	bool HasLineOfSight(AActor* Target) const;
+
+	// Last synchronous line of sight result, reused while the LOD tier disallows traces
+	mutable TWeakObjectPtr<AActor> LastLineOfSightTarget;
+	mutable bool bLastLineOfSight = false;
+
+	void QueryAreaOfEffectTargets(const FVector& Center, float Radius, TArray<AActor*>& OutActors) const;
+	const FAILODTierSettings* GetLODSettings() const;
 };
@@ -2,7 +2,14 @@
 
 #include "CombatEntity.h"
 #include "NinjaWizardCharacter.h"
+#include "CombatSpatialHashSubsystem.h"
+#include "AIThreatMapSubsystem.h"
+#include "AITickManagerSubsystem.h"
+#include "AIBehaviorComponent.h"
+#include "CombatAIComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Reverse.h"
 
 ACombatEntity::ACombatEntity()
 {
@@ -49,6 +56,33 @@ void ACombatEntity::BeginPlay()
 	{
 		Movement->MaxWalkSpeed = MovementSpeed;
 	}
+
+	// Make this entity visible to gameplay proximity queries
+	if (UCombatSpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHashSubsystem>())
+	{
+		SpatialHash->RegisterActor(this, ECombatSpatialKind::CombatEntity);
+	}
+
+	// Only summons and bosses carry threat, but either can change at runtime
+	if (UAIThreatMapSubsystem* ThreatMap = GetWorld()->GetSubsystem<UAIThreatMapSubsystem>())
+	{
+		ThreatMap->RegisterSource(this);
+	}
+}
+
+void ACombatEntity::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UCombatSpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHashSubsystem>())
+	{
+		SpatialHash->UnregisterActor(this);
+	}
+
+	if (UAIThreatMapSubsystem* ThreatMap = GetWorld()->GetSubsystem<UAIThreatMapSubsystem>())
+	{
+		ThreatMap->UnregisterSource(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ACombatEntity::Tick(float DeltaTime)
@@ -67,13 +101,23 @@ void ACombatEntity::ApplyDamageFrom(float Damage, AActor* DamageDealer)
 		return;
 	}
 
+	// Damage from beyond the activation radius (e.g. a long range spell) still wakes a dormant mob
+	if (UAITickManagerSubsystem* TickManager = GetWorld()->GetSubsystem<UAITickManagerSubsystem>())
+	{
+		TickManager->WakeAgent(FindComponentByClass<UAIBehaviorComponent>());
+	}
+
 	// Apply defense reduction
 	float ActualDamage = FMath::Max(Damage - Defense, 0.0f);
-	CurrentHealth -= ActualDamage;
+	SetCurrentHealth(CurrentHealth - ActualDamage);
+
+	if (UCombatAIComponent* CombatAI = FindComponentByClass<UCombatAIComponent>())
+	{
+		CombatAI->NotifyDamagedBy(DamageDealer, ActualDamage);
+	}
 
 	if (CurrentHealth <= 0)
 	{
-		CurrentHealth = 0;
 		Die();
 	}
 }
@@ -102,7 +146,7 @@ void ACombatEntity::Die()
 		return; // Already dead
 	}
 
-	CurrentHealth = 0;
+	SetCurrentHealth(0.0f);
 
 	// Trigger death event
 	OnDeath(nullptr);
@@ -126,6 +170,81 @@ float ACombatEntity::GetHealthPercentage() const
 	return MaxHealth > 0 ? (CurrentHealth / MaxHealth) : 0.0f;
 }
 
+void ACombatEntity::SetCurrentHealth(float NewHealth)
+{
+	const float OldHealth = CurrentHealth;
+	CurrentHealth = FMath::Clamp(NewHealth, 0.0f, MaxHealth);
+	if (CurrentHealth == OldHealth) return;
+
+	OnHealthChanged(OldHealth, CurrentHealth);
+	NotifyHealthThresholds(OldHealth, CurrentHealth);
+}
+
+// ============================================
+// Health Observers
+// ============================================
+
+int32 ACombatEntity::RegisterHealthThreshold(float Threshold, FHealthThresholdDelegate Callback)
+{
+	FHealthThresholdObserver Observer;
+	Observer.Threshold = Threshold;
+	Observer.Handle = NextHealthThresholdHandle++;
+	Observer.Callback = MoveTemp(Callback);
+
+	const int32 Index = Algo::UpperBoundBy(HealthThresholds, Threshold, &FHealthThresholdObserver::Threshold);
+	HealthThresholds.Insert(MoveTemp(Observer), Index);
+
+	return HealthThresholds[Index].Handle;
+}
+
+int32 ACombatEntity::AddHealthThreshold(float Threshold)
+{
+	return RegisterHealthThreshold(Threshold, FHealthThresholdDelegate());
+}
+
+void ACombatEntity::UnregisterHealthThreshold(int32 Handle)
+{
+	HealthThresholds.RemoveAll([Handle](const FHealthThresholdObserver& Observer) { return Observer.Handle == Handle; });
+}
+
+void ACombatEntity::NotifyHealthThresholds(float OldHealth, float NewHealth)
+{
+	if (HealthThresholds.Num() == 0 || MaxHealth <= 0.0f) return;
+
+	// At or below a threshold counts as below it, so crossed thresholds lie in [Low, High)
+	const float OldFraction = OldHealth / MaxHealth;
+	const float NewFraction = NewHealth / MaxHealth;
+	const float Low = FMath::Min(OldFraction, NewFraction);
+	const float High = FMath::Max(OldFraction, NewFraction);
+	const bool bFellBelow = NewFraction < OldFraction;
+
+	// Callbacks may register or unregister observers, so deliver from a copy
+	TArray<FHealthThresholdObserver, TInlineAllocator<4>> Crossed;
+	for (int32 Index = Algo::LowerBoundBy(HealthThresholds, Low, &FHealthThresholdObserver::Threshold);
+		Index < HealthThresholds.Num() && HealthThresholds[Index].Threshold < High; Index++)
+	{
+		Crossed.Add(HealthThresholds[Index]);
+	}
+
+	// Report in the order health passed them
+	if (bFellBelow)
+	{
+		Algo::Reverse(Crossed);
+	}
+
+	for (const FHealthThresholdObserver& Observer : Crossed)
+	{
+		if (Observer.Callback.IsBound())
+		{
+			Observer.Callback.Execute(Observer.Threshold, bFellBelow);
+		}
+		else
+		{
+			OnHealthThresholdCrossed(Observer.Threshold, bFellBelow);
+		}
+	}
+}
+
 // ============================================
 // Summon Functions
 // ============================================
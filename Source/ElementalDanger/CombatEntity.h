@@ -10,6 +10,21 @@
 
 class ANinjaWizardCharacter;
 
+// Threshold crossed, true when health fell to or below it
+DECLARE_DELEGATE_TwoParams(FHealthThresholdDelegate, float, bool);
+
+/**
+ * A health fraction someone wants to hear about when it is crossed
+ */
+struct FHealthThresholdObserver
+{
+	float Threshold = 0.0f;
+	int32 Handle = INDEX_NONE;
+
+	// Unbound for thresholds added from Blueprint, which receive OnHealthThresholdCrossed instead
+	FHealthThresholdDelegate Callback;
+};
+
 /**
  * Base class for all combat entities (enemies and allies/summons)
  */
@@ -23,6 +38,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void Tick(float DeltaTime) override;
@@ -132,6 +148,24 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	float GetHealthPercentage() const;
 
+	// Every gameplay health change goes through here so observers are notified; spawn setup assigns directly
+	UFUNCTION(BlueprintCallable, Category = "Combat")
+	void SetCurrentHealth(float NewHealth);
+
+	// ============================================
+	// Health Observers
+	// ============================================
+
+	// Threshold is a health fraction; Callback fires whenever health crosses it in either direction. Returns a handle.
+	int32 RegisterHealthThreshold(float Threshold, FHealthThresholdDelegate Callback);
+
+	// Reports crossings of Threshold through OnHealthThresholdCrossed
+	UFUNCTION(BlueprintCallable, Category = "Combat|Health Observers")
+	int32 AddHealthThreshold(float Threshold);
+
+	UFUNCTION(BlueprintCallable, Category = "Combat|Health Observers")
+	void UnregisterHealthThreshold(int32 Handle);
+
 	// ============================================
 	// Summon Functions
 	// ============================================
@@ -215,7 +249,19 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Events")
 	void OnDismissed();
 
+	UFUNCTION(BlueprintImplementableEvent, Category = "Events")
+	void OnHealthChanged(float OldHealth, float NewHealth);
+
+	UFUNCTION(BlueprintImplementableEvent, Category = "Events")
+	void OnHealthThresholdCrossed(float Threshold, bool bFellBelow);
+
 protected:
 	virtual void ApplyRankBonuses();
 	virtual void ApplyLevelBonuses();
+
+	// Sorted by ascending threshold, so a health change finds its crossings with a binary search
+	TArray<FHealthThresholdObserver> HealthThresholds;
+	int32 NextHealthThresholdHandle = 0;
+
+	void NotifyHealthThresholds(float OldHealth, float NewHealth);
 };
@@ -54,12 +54,6 @@ void UCombatMovementComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	UpdateState(DeltaTime);
-
-	// Update cooldown timers
-	if (DodgeCooldownTimer > 0.0f)
-	{
-		DodgeCooldownTimer -= DeltaTime;
-	}
 }
 
 // ============================================
@@ -179,7 +173,7 @@ FParryResult UCombatMovementComponent::AttemptParry(AActor* Attacker, float Inco
 bool UCombatMovementComponent::StartDodge(FVector Direction)
 {
 	if (!CanPerformAction()) return false;
-	if (DodgeCooldownTimer > 0.0f) return false;
+	if (DodgeCooldownState.IsActive(GetWorld())) return false;
 
 	// TODO: Check stamina
 	// if (!HasEnoughStamina(DodgeStaminaCost)) return false;
@@ -190,7 +184,7 @@ bool UCombatMovementComponent::StartDodge(FVector Direction)
 	bIsInvulnerable = true;
 
 	ChangeState(ECombatMovementState::Dodging);
-	DodgeCooldownTimer = DodgeCooldown;
+	DodgeCooldownState.Start(GetWorld(), DodgeCooldown);
 
 	OnDodgeStarted(DodgeDirection);
 
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "CooldownTypes.h"
 #include "CombatMovementComponent.generated.h"
 
 UENUM(BlueprintType)
@@ -274,8 +275,7 @@ protected:
 	// Cooldown Tracking
 	// ============================================
 
-	UPROPERTY()
-	float DodgeCooldownTimer = 0.0f;
+	FCooldown DodgeCooldownState;
 
 	UPROPERTY()
 	AActor* OwnerCharacter;
@@ -0,0 +1,269 @@
+// Combat Projectile Subsystem Implementation
+
+#include "CombatProjectileSubsystem.h"
+#include "CombatSpatialHashSubsystem.h"
+#include "CombatEntity.h"
+#include "NinjaWizardCharacter.h"
+#include "GameFramework/MovementComponent.h"
+
+// ============================================
+// Projectile Data
+// ============================================
+
+void FCombatProjectileData::RemoveAtSwap(int32 Index)
+{
+	Positions.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Radii.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Damages.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	GravityScales.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	ExpiryTimes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Elements.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PlayerSide.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Instigators.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Cosmetics.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+void FCombatProjectileData::Empty()
+{
+	Positions.Empty();
+	Velocities.Empty();
+	Radii.Empty();
+	Damages.Empty();
+	GravityScales.Empty();
+	ExpiryTimes.Empty();
+	Elements.Empty();
+	PlayerSide.Empty();
+	Instigators.Empty();
+	Cosmetics.Empty();
+}
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UCombatProjectileSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatProjectileSubsystem::Deinitialize()
+{
+	Projectiles.Empty();
+	PendingHits.Empty();
+	SweepResults.Empty();
+	ActorPools.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UCombatProjectileSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatProjectileSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatProjectileSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Projectiles.Num() == 0) return;
+
+	const UCombatSpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHashSubsystem>();
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// Descending, so spent projectiles are swapped out with ones already simulated
+	for (int32 Index = Projectiles.Num() - 1; Index >= 0; --Index)
+	{
+		const bool bHit = SimulateProjectile(Index, DeltaTime, SpatialHash);
+
+		if (bHit || Now >= Projectiles.ExpiryTimes[Index])
+		{
+			ReleaseCosmetic(Projectiles.Cosmetics[Index].Get());
+			Projectiles.RemoveAtSwap(Index);
+		}
+		else if (AActor* Cosmetic = Projectiles.Cosmetics[Index].Get())
+		{
+			Cosmetic->SetActorLocationAndRotation(Projectiles.Positions[Index], Projectiles.Velocities[Index].Rotation());
+		}
+	}
+
+	ResolveHits();
+}
+
+// ============================================
+// Projectiles
+// ============================================
+
+void UCombatProjectileSubsystem::LaunchProjectile(const FVector& Location, const FVector& Direction, const FCombatProjectileParams& Params, AActor* Instigator)
+{
+	const FVector LaunchDirection = Direction.GetSafeNormal();
+	if (LaunchDirection.IsNearlyZero() || Params.Speed <= 0.0f) return;
+
+	Projectiles.Positions.Add(Location);
+	Projectiles.Velocities.Add(LaunchDirection * Params.Speed);
+	Projectiles.Radii.Add(Params.Radius);
+	Projectiles.Damages.Add(Params.Damage);
+	Projectiles.GravityScales.Add(Params.GravityScale);
+	Projectiles.ExpiryTimes.Add(GetWorld()->GetTimeSeconds() + Params.Lifetime);
+	Projectiles.Elements.Add(Params.Element);
+	Projectiles.PlayerSide.Add(IsPlayerSide(Instigator));
+	Projectiles.Instigators.Add(Instigator);
+	Projectiles.Cosmetics.Add(Params.CosmeticClass ? AcquireCosmetic(Params.CosmeticClass, Location, LaunchDirection.Rotation()) : nullptr);
+}
+
+bool UCombatProjectileSubsystem::SimulateProjectile(int32 Index, float DeltaTime, const UCombatSpatialHashSubsystem* SpatialHash)
+{
+	FVector& Position = Projectiles.Positions[Index];
+	FVector& Velocity = Projectiles.Velocities[Index];
+	const float Radius = Projectiles.Radii[Index];
+	const FVector Gravity(0.0f, 0.0f, GetWorld()->GetGravityZ() * Projectiles.GravityScales[Index]);
+
+	const float FrameDistance = Velocity.Size() * DeltaTime;
+	const int32 NumSubsteps = FMath::Clamp(FMath::CeilToInt(FrameDistance / FMath::Max(MaxSubstepDistance, 1.0f)), 1, FMath::Max(MaxSubsteps, 1));
+	const float SubstepTime = DeltaTime / NumSubsteps;
+
+	AActor* Instigator = Projectiles.Instigators[Index].Get();
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(CombatProjectile), false, Instigator);
+
+	// Player projectiles hit enemies, everything else hits players and their summons
+	const bool bPlayerSide = Projectiles.PlayerSide[Index];
+	FCombatEntityQueryFilter Filter;
+	Filter.bIncludeEnemies = bPlayerSide;
+	Filter.bIncludeSummons = !bPlayerSide;
+	Filter.bIncludePlayers = !bPlayerSide;
+	Filter.IgnoredActor = Instigator;
+
+	for (int32 Step = 0; Step < NumSubsteps; Step++)
+	{
+		const FVector Start = Position;
+		FVector End = Start + Velocity * SubstepTime + 0.5f * Gravity * FMath::Square(SubstepTime);
+		Velocity += Gravity * SubstepTime;
+
+		// Level geometry shortens the segment, characters along what is left are hit first
+		FHitResult WorldHit;
+		const bool bHitWorld = GetWorld()->LineTraceSingleByChannel(WorldHit, Start, End, WorldCollisionChannel, QueryParams);
+		if (bHitWorld)
+		{
+			End = WorldHit.Location;
+		}
+
+		AActor* HitActor = nullptr;
+		if (SpatialHash)
+		{
+			SpatialHash->QuerySweptSphere(Start, End, Radius, Filter, SweepResults);
+
+			float ClosestDistanceSquared = TNumericLimits<float>::Max();
+			for (AActor* Candidate : SweepResults)
+			{
+				const float DistanceSquared = FVector::DistSquared(Start, Candidate->GetActorLocation());
+				if (DistanceSquared < ClosestDistanceSquared)
+				{
+					ClosestDistanceSquared = DistanceSquared;
+					HitActor = Candidate;
+				}
+			}
+		}
+
+		if (HitActor || bHitWorld)
+		{
+			FCombatProjectileHit& Hit = PendingHits.AddDefaulted_GetRef();
+			Hit.Target = HitActor;
+			Hit.Instigator = Projectiles.Instigators[Index];
+			Hit.Location = HitActor ? FMath::ClosestPointOnSegment(HitActor->GetActorLocation(), Start, End) : End;
+			Hit.Damage = Projectiles.Damages[Index];
+			Hit.Element = Projectiles.Elements[Index];
+
+			Position = Hit.Location;
+			return true;
+		}
+
+		Position = End;
+	}
+
+	return false;
+}
+
+void UCombatProjectileSubsystem::ResolveHits()
+{
+	if (PendingHits.Num() == 0) return;
+
+	// Damage can kill, spawn or launch, so deliver from a copy
+	TArray<FCombatProjectileHit> Hits = MoveTemp(PendingHits);
+	PendingHits.Reset();
+
+	for (const FCombatProjectileHit& Hit : Hits)
+	{
+		AActor* Instigator = Hit.Instigator.Get();
+
+		if (ACombatEntity* TargetEntity = Cast<ACombatEntity>(Hit.Target.Get()))
+		{
+			TargetEntity->ApplyDamageFrom(Hit.Damage, Instigator);
+		}
+		else if (ANinjaWizardCharacter* Player = Cast<ANinjaWizardCharacter>(Hit.Target.Get()))
+		{
+			Player->TakeDamageFrom(Hit.Damage, Instigator);
+		}
+
+		OnProjectileHit.Broadcast(Hit);
+	}
+}
+
+bool UCombatProjectileSubsystem::IsPlayerSide(const AActor* Actor)
+{
+	if (!Actor) return false;
+	if (Actor->IsA<ANinjaWizardCharacter>()) return true;
+
+	const ACombatEntity* Entity = Cast<ACombatEntity>(Actor);
+	return Entity && Entity->bIsPlayerSummon;
+}
+
+// ============================================
+// Cosmetic Pool
+// ============================================
+
+AActor* UCombatProjectileSubsystem::AcquireCosmetic(UClass* CosmeticClass, const FVector& Location, const FRotator& Rotation)
+{
+	FCombatProjectileActorPool& Pool = ActorPools.FindOrAdd(CosmeticClass);
+	while (Pool.Actors.Num() > 0)
+	{
+		AActor* Cosmetic = Pool.Actors.Pop(EAllowShrinking::No);
+		if (!IsValid(Cosmetic)) continue;
+
+		Cosmetic->SetActorLocationAndRotation(Location, Rotation);
+		Cosmetic->SetActorHiddenInGame(false);
+		return Cosmetic;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AActor* Cosmetic = GetWorld()->SpawnActor<AActor>(CosmeticClass, Location, Rotation, SpawnParams);
+	if (!Cosmetic) return nullptr;
+
+	// The simulation owns movement, impacts and lifetime; the actor only has to look right
+	Cosmetic->SetActorEnableCollision(false);
+	Cosmetic->SetLifeSpan(0.0f);
+
+	TInlineComponentArray<UMovementComponent*> MovementComponents(Cosmetic);
+	for (UMovementComponent* Movement : MovementComponents)
+	{
+		Movement->Deactivate();
+	}
+
+	return Cosmetic;
+}
+
+void UCombatProjectileSubsystem::ReleaseCosmetic(AActor* Cosmetic)
+{
+	if (!IsValid(Cosmetic)) return;
+
+	FCombatProjectileActorPool& Pool = ActorPools.FindOrAdd(Cosmetic->GetClass());
+	if (Pool.Actors.Num() >= MaxPooledActorsPerClass)
+	{
+		Cosmetic->Destroy();
+		return;
+	}
+
+	Cosmetic->SetActorHiddenInGame(true);
+	Pool.Actors.Add(Cosmetic);
+}
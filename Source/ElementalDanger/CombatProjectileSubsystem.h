@@ -0,0 +1,171 @@
+// Combat Projectile Subsystem - Projectiles simulated as plain data instead of one actor each
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "MagicTypes.h"
+#include "CombatProjectileSubsystem.generated.h"
+
+class UCombatSpatialHashSubsystem;
+
+/**
+ * How a launched projectile flies and what it does on impact
+ */
+USTRUCT(BlueprintType)
+struct FCombatProjectileParams
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+	float Speed = 1000.0f;
+
+	// Collision radius used when sweeping against combat entities and players
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+	float Radius = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+	float Damage = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+	EMagicElement Element = EMagicElement::None;
+
+	// Seconds before the projectile expires without hitting anything
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+	float Lifetime = 5.0f;
+
+	// Multiplier on world gravity, 0 flies straight
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+	float GravityScale = 0.0f;
+
+	// Optional actor pooled and moved along with the projectile for visuals only
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
+	TSubclassOf<AActor> CosmeticClass;
+};
+
+/**
+ * A projectile impact waiting to be resolved at the end of the frame.
+ * Target is null when the projectile hit world geometry.
+ */
+struct FCombatProjectileHit
+{
+	TWeakObjectPtr<AActor> Target;
+	TWeakObjectPtr<AActor> Instigator;
+	FVector Location = FVector::ZeroVector;
+	float Damage = 0.0f;
+	EMagicElement Element = EMagicElement::None;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FCombatProjectileHitDelegate, const FCombatProjectileHit&);
+
+/**
+ * Idle cosmetic actors of one class
+ */
+USTRUCT()
+struct FCombatProjectileActorPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<AActor*> Actors;
+};
+
+/**
+ * Every live projectile, one array per field so the sweep loop walks memory in order
+ */
+struct FCombatProjectileData
+{
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<float> Radii;
+	TArray<float> Damages;
+	TArray<float> GravityScales;
+	TArray<double> ExpiryTimes;
+	TArray<EMagicElement> Elements;
+	TArray<bool> PlayerSide;
+	TArray<TWeakObjectPtr<AActor>> Instigators;
+	TArray<TWeakObjectPtr<AActor>> Cosmetics;
+
+	int32 Num() const { return Positions.Num(); }
+
+	void RemoveAtSwap(int32 Index);
+	void Empty();
+};
+
+/**
+ * Simulates projectiles fired by players, summons and enemies without spawning an actor for
+ * each one. Projectiles are swept in sub-steps against world geometry and against the combat
+ * spatial hash, impacts are queued and resolved in a single pass at the end of the tick, and an
+ * optional cosmetic actor per projectile is drawn from a per-class pool.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UCombatProjectileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ============================================
+	// Configuration
+	// ============================================
+
+	// Longest distance a projectile moves between collision checks
+	UPROPERTY(Config, BlueprintReadOnly, Category = "Combat Projectiles")
+	float MaxSubstepDistance = 150.0f;
+
+	UPROPERTY(Config, BlueprintReadOnly, Category = "Combat Projectiles")
+	int32 MaxSubsteps = 8;
+
+	// Channel that stops projectiles on level geometry
+	UPROPERTY(Config, BlueprintReadOnly, Category = "Combat Projectiles")
+	TEnumAsByte<ECollisionChannel> WorldCollisionChannel = ECC_WorldStatic;
+
+	// Idle cosmetic actors kept per class, extras are destroyed
+	UPROPERTY(Config, BlueprintReadOnly, Category = "Combat Projectiles")
+	int32 MaxPooledActorsPerClass = 32;
+
+	// ============================================
+	// Projectiles
+	// ============================================
+
+	// Fires a projectile from Location along Direction. Instigator decides which side it damages and is never hit.
+	UFUNCTION(BlueprintCallable, Category = "Combat Projectiles")
+	void LaunchProjectile(const FVector& Location, const FVector& Direction, const FCombatProjectileParams& Params, AActor* Instigator);
+
+	UFUNCTION(BlueprintCallable, Category = "Combat Projectiles")
+	int32 GetNumProjectiles() const { return Projectiles.Num(); }
+
+	// Broadcast for every impact after its damage was applied
+	FCombatProjectileHitDelegate OnProjectileHit;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	FCombatProjectileData Projectiles;
+	TArray<FCombatProjectileHit> PendingHits;
+
+	// Reused by every sweep query
+	TArray<AActor*> SweepResults;
+
+	UPROPERTY()
+	TMap<UClass*, FCombatProjectileActorPool> ActorPools;
+
+	// Moves one projectile through this frame's sub-steps, returns true when it hit something
+	bool SimulateProjectile(int32 Index, float DeltaTime, const UCombatSpatialHashSubsystem* SpatialHash);
+
+	void ResolveHits();
+
+	AActor* AcquireCosmetic(UClass* CosmeticClass, const FVector& Location, const FRotator& Rotation);
+	void ReleaseCosmetic(AActor* Cosmetic);
+
+	// True for players and their summons
+	static bool IsPlayerSide(const AActor* Actor);
+};
@@ -0,0 +1,350 @@
+// Combat Spatial Hash Subsystem Implementation
+
+#include "CombatSpatialHashSubsystem.h"
+#include "CombatEntity.h"
+#include "NinjaWizardCharacter.h"
+#include "Components/CapsuleComponent.h"
+
+namespace
+{
+	// Smaller cells from a bad config would divide by zero or explode the cell count
+	constexpr float MinCellSize = 100.0f;
+}
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UCombatSpatialHashSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatSpatialHashSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CellSize = FMath::Max(CellSize, MinCellSize);
+}
+
+void UCombatSpatialHashSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	EntryIndices.Empty();
+	Cells.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UCombatSpatialHashSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatSpatialHashSubsystem, STATGROUP_Tickables);
+}
+
+void UCombatSpatialHashSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Only entries that crossed a cell boundary touch the cell map
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		FCombatSpatialEntry& Entry = Entries[Index];
+		if (!IsValid(Entry.Actor)) continue;
+
+		Entry.Location = Entry.Actor->GetActorLocation();
+
+		const FIntPoint NewCell = GetCell(Entry.Location);
+		if (NewCell != Entry.Cell)
+		{
+			RemoveFromCell(Entry.Cell, Index);
+			AddToCell(NewCell, Index);
+			Entry.Cell = NewCell;
+		}
+	}
+}
+
+// ============================================
+// Registration
+// ============================================
+
+void UCombatSpatialHashSubsystem::RegisterActor(AActor* Actor, ECombatSpatialKind Kind)
+{
+	if (!Actor || EntryIndices.Contains(Actor)) return;
+
+	FCombatSpatialEntry Entry;
+	Entry.Actor = Actor;
+	Entry.Kind = Kind;
+	Entry.Location = Actor->GetActorLocation();
+	Entry.Cell = GetCell(Entry.Location);
+	RefreshBounds(Entry);
+
+	MaxEntryRadius = FMath::Max(MaxEntryRadius, Entry.Radius);
+	MaxEntryHalfHeight = FMath::Max(MaxEntryHalfHeight, Entry.HalfHeight);
+
+	const int32 Index = Entries.Add(Entry);
+	EntryIndices.Add(Actor, Index);
+	AddToCell(Entry.Cell, Index);
+}
+
+void UCombatSpatialHashSubsystem::UnregisterActor(AActor* Actor)
+{
+	int32 Index = INDEX_NONE;
+	if (!Actor || !EntryIndices.RemoveAndCopyValue(Actor, Index)) return;
+
+	RemoveFromCell(Entries[Index].Cell, Index);
+
+	// Move the last entry into the freed slot and patch its references
+	const int32 LastIndex = Entries.Num() - 1;
+	if (Index != LastIndex)
+	{
+		FCombatSpatialEntry& Moved = Entries[LastIndex];
+		if (TArray<int32>* CellEntries = Cells.Find(Moved.Cell))
+		{
+			const int32 CellSlot = CellEntries->Find(LastIndex);
+			if (CellSlot != INDEX_NONE)
+			{
+				(*CellEntries)[CellSlot] = Index;
+			}
+		}
+
+		if (Moved.Actor)
+		{
+			EntryIndices.Add(Moved.Actor, Index);
+		}
+	}
+
+	Entries.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+// ============================================
+// Queries
+// ============================================
+
+template <typename FunctorType>
+void UCombatSpatialHashSubsystem::ForEachEntryInBounds(const FVector& Min, const FVector& Max, FunctorType&& Functor) const
+{
+	const FVector Padding(MaxEntryRadius, MaxEntryRadius, 0.0f);
+	const FIntPoint MinCell = GetCell(Min - Padding);
+	const FIntPoint MaxCell = GetCell(Max + Padding);
+
+	// Each entry lives in exactly one cell, so results never contain duplicates
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			const TArray<int32>* CellEntries = Cells.Find(FIntPoint(X, Y));
+			if (!CellEntries) continue;
+
+			for (const int32 EntryIndex : *CellEntries)
+			{
+				const FCombatSpatialEntry& Entry = Entries[EntryIndex];
+				if (Entry.Location.Z + Entry.HalfHeight < Min.Z || Entry.Location.Z - Entry.HalfHeight > Max.Z) continue;
+
+				Functor(Entry);
+			}
+		}
+	}
+}
+
+void UCombatSpatialHashSubsystem::QuerySphere(const FVector& Center, float Radius, const FCombatEntityQueryFilter& Filter, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset();
+
+	const FVector Extent(Radius);
+	ForEachEntryInBounds(Center - Extent, Center + Extent, [&](const FCombatSpatialEntry& Entry)
+	{
+		if (PassesFilter(Entry, Filter) && DistanceToEntryAxis(Center, Entry) <= Radius + Entry.Radius)
+		{
+			OutActors.Add(Entry.Actor);
+		}
+	});
+}
+
+void UCombatSpatialHashSubsystem::QueryBox(const FBox& Box, const FCombatEntityQueryFilter& Filter, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset();
+	if (!Box.IsValid) return;
+
+	ForEachEntryInBounds(Box.Min, Box.Max, [&](const FCombatSpatialEntry& Entry)
+	{
+		const FBox ExpandedBox = Box.ExpandBy(FVector(Entry.Radius, Entry.Radius, Entry.HalfHeight));
+		if (PassesFilter(Entry, Filter) && ExpandedBox.IsInsideOrOn(Entry.Location))
+		{
+			OutActors.Add(Entry.Actor);
+		}
+	});
+}
+
+void UCombatSpatialHashSubsystem::QueryCone(const FVector& Origin, const FVector& Direction, float Length, float HalfAngleDegrees,
+	const FCombatEntityQueryFilter& Filter, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset();
+
+	const FVector Axis = Direction.GetSafeNormal();
+	if (Axis.IsNearlyZero()) return;
+
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.0f, 180.0f)));
+	const FVector Extent(Length);
+
+	ForEachEntryInBounds(Origin - Extent, Origin + Extent, [&](const FCombatSpatialEntry& Entry)
+	{
+		if (!PassesFilter(Entry, Filter)) return;
+
+		const FVector ToEntry = Entry.Location - Origin;
+		const float Distance = ToEntry.Size();
+		if (Distance > Length + Entry.Radius) return;
+
+		// Inside the cone angle, or close enough to the axis that its capsule pokes in
+		const float AlongAxis = FVector::DotProduct(ToEntry, Axis);
+		const bool bInsideAngle = Distance <= KINDA_SMALL_NUMBER || AlongAxis >= Distance * CosHalfAngle;
+		const bool bTouchesAxis = AlongAxis > 0.0f && (ToEntry - Axis * AlongAxis).Size() <= Entry.Radius;
+
+		if (bInsideAngle || bTouchesAxis)
+		{
+			OutActors.Add(Entry.Actor);
+		}
+	});
+}
+
+void UCombatSpatialHashSubsystem::QuerySweptSphere(const FVector& Start, const FVector& End, float Radius,
+	const FCombatEntityQueryFilter& Filter, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset();
+
+	const FVector Extent(Radius);
+	const FVector Min = Start.ComponentMin(End) - Extent;
+	const FVector Max = Start.ComponentMax(End) + Extent;
+
+	ForEachEntryInBounds(Min, Max, [&](const FCombatSpatialEntry& Entry)
+	{
+		if (!PassesFilter(Entry, Filter)) return;
+
+		const float AxisOffset = FMath::Max(Entry.HalfHeight - Entry.Radius, 0.0f);
+		FVector ClosestOnSweep;
+		FVector ClosestOnAxis;
+		FMath::SegmentDistToSegment(Start, End,
+			Entry.Location - FVector(0.0f, 0.0f, AxisOffset),
+			Entry.Location + FVector(0.0f, 0.0f, AxisOffset),
+			ClosestOnSweep, ClosestOnAxis);
+
+		if (FVector::Dist(ClosestOnSweep, ClosestOnAxis) <= Radius + Entry.Radius)
+		{
+			OutActors.Add(Entry.Actor);
+		}
+	});
+}
+
+void UCombatSpatialHashSubsystem::QueryKNearest(const FVector& Origin, int32 Count, float MaxRadius,
+	const FCombatEntityQueryFilter& Filter, TArray<AActor*>& OutActors) const
+{
+	OutActors.Reset();
+	if (Count <= 0 || MaxRadius <= 0.0f) return;
+
+	// Grow the search radius until enough candidates are found
+	TArray<TPair<float, AActor*>> Candidates;
+	float SearchRadius = FMath::Min(CellSize, MaxRadius);
+
+	while (true)
+	{
+		Candidates.Reset();
+
+		const FVector Extent(SearchRadius);
+		ForEachEntryInBounds(Origin - Extent, Origin + Extent, [&](const FCombatSpatialEntry& Entry)
+		{
+			if (!PassesFilter(Entry, Filter)) return;
+
+			const float Distance = FVector::Dist(Origin, Entry.Location);
+			if (Distance <= SearchRadius)
+			{
+				Candidates.Emplace(Distance, Entry.Actor);
+			}
+		});
+
+		if (Candidates.Num() >= Count || SearchRadius >= MaxRadius) break;
+		SearchRadius = FMath::Min(SearchRadius * 2.0f, MaxRadius);
+	}
+
+	Candidates.Sort([](const TPair<float, AActor*>& A, const TPair<float, AActor*>& B)
+	{
+		return A.Key < B.Key;
+	});
+
+	const int32 ResultCount = FMath::Min(Count, Candidates.Num());
+	OutActors.Reserve(ResultCount);
+	for (int32 Index = 0; Index < ResultCount; ++Index)
+	{
+		OutActors.Add(Candidates[Index].Value);
+	}
+}
+
+// ============================================
+// Internal
+// ============================================
+
+FIntPoint UCombatSpatialHashSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void UCombatSpatialHashSubsystem::RefreshBounds(FCombatSpatialEntry& Entry) const
+{
+	Entry.Radius = 0.0f;
+	Entry.HalfHeight = 0.0f;
+
+	if (const ACharacter* Character = Cast<ACharacter>(Entry.Actor))
+	{
+		if (const UCapsuleComponent* Capsule = Character->GetCapsuleComponent())
+		{
+			Entry.Radius = Capsule->GetScaledCapsuleRadius();
+			Entry.HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+		}
+	}
+}
+
+void UCombatSpatialHashSubsystem::AddToCell(const FIntPoint& Cell, int32 EntryIndex)
+{
+	Cells.FindOrAdd(Cell).Add(EntryIndex);
+}
+
+void UCombatSpatialHashSubsystem::RemoveFromCell(const FIntPoint& Cell, int32 EntryIndex)
+{
+	if (TArray<int32>* CellEntries = Cells.Find(Cell))
+	{
+		CellEntries->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+		if (CellEntries->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+bool UCombatSpatialHashSubsystem::PassesFilter(const FCombatSpatialEntry& Entry, const FCombatEntityQueryFilter& Filter) const
+{
+	if (!IsValid(Entry.Actor) || Entry.Actor == Filter.IgnoredActor) return false;
+
+	if (Entry.Kind == ECombatSpatialKind::Player)
+	{
+		if (!Filter.bIncludePlayers) return false;
+
+		const ANinjaWizardCharacter* Player = Cast<ANinjaWizardCharacter>(Entry.Actor);
+		return !Filter.bAliveOnly || !Player || !Player->IsDead();
+	}
+
+	// Summon status can change at runtime, so read it from the entity
+	const ACombatEntity* Entity = Cast<ACombatEntity>(Entry.Actor);
+	if (!Entity) return false;
+
+	if (Entity->bIsPlayerSummon ? !Filter.bIncludeSummons : !Filter.bIncludeEnemies) return false;
+
+	return !Filter.bAliveOnly || Entity->IsAlive();
+}
+
+float UCombatSpatialHashSubsystem::DistanceToEntryAxis(const FVector& Point, const FCombatSpatialEntry& Entry)
+{
+	const float AxisOffset = FMath::Max(Entry.HalfHeight - Entry.Radius, 0.0f);
+	const FVector ClosestPoint = FMath::ClosestPointOnSegment(Point,
+		Entry.Location - FVector(0.0f, 0.0f, AxisOffset),
+		Entry.Location + FVector(0.0f, 0.0f, AxisOffset));
+
+	return FVector::Dist(Point, ClosestPoint);
+}
@@ -0,0 +1,150 @@
+// Combat Spatial Hash Subsystem - Uniform grid of combat entities, summons and players for proximity queries
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatSpatialHashSubsystem.generated.h"
+
+/**
+ * What kind of actor a spatial hash entry represents
+ */
+UENUM(BlueprintType)
+enum class ECombatSpatialKind : uint8
+{
+	CombatEntity    UMETA(DisplayName = "Combat Entity"),
+	Player          UMETA(DisplayName = "Player")
+};
+
+/**
+ * Which registered actors a proximity query may return
+ */
+USTRUCT(BlueprintType)
+struct FCombatEntityQueryFilter
+{
+	GENERATED_BODY()
+
+	// Combat entities that are not player summons
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spatial Query")
+	bool bIncludeEnemies = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spatial Query")
+	bool bIncludeSummons = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spatial Query")
+	bool bIncludePlayers = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spatial Query")
+	bool bAliveOnly = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spatial Query")
+	AActor* IgnoredActor = nullptr;
+};
+
+/**
+ * A registered actor with its cached bounds and grid cell
+ */
+USTRUCT()
+struct FCombatSpatialEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	AActor* Actor = nullptr;
+
+	FVector Location = FVector::ZeroVector;
+	float Radius = 0.0f;
+	float HalfHeight = 0.0f;
+	FIntPoint Cell = FIntPoint::ZeroValue;
+	ECombatSpatialKind Kind = ECombatSpatialKind::CombatEntity;
+};
+
+/**
+ * Incrementally updated 2D spatial hash of every live combat entity, summon and player.
+ * Gameplay-only proximity queries use this instead of physics sweeps and always
+ * return each actor at most once.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UCombatSpatialHashSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ============================================
+	// Configuration
+	// ============================================
+
+	// Edge length of a grid cell in world units, clamped to MinCellSize on initialize
+	UPROPERTY(Config, BlueprintReadOnly, Category = "Spatial Hash")
+	float CellSize = 1000.0f;
+
+	// ============================================
+	// Registration
+	// ============================================
+
+	void RegisterActor(AActor* Actor, ECombatSpatialKind Kind);
+	void UnregisterActor(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category = "Spatial Hash")
+	int32 GetNumRegistered() const { return Entries.Num(); }
+
+	// ============================================
+	// Queries
+	// ============================================
+
+	UFUNCTION(BlueprintCallable, Category = "Spatial Hash")
+	void QuerySphere(const FVector& Center, float Radius, const FCombatEntityQueryFilter& Filter, TArray<AActor*>& OutActors) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Spatial Hash")
+	void QueryBox(const FBox& Box, const FCombatEntityQueryFilter& Filter, TArray<AActor*>& OutActors) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Spatial Hash")
+	void QueryCone(const FVector& Origin, const FVector& Direction, float Length, float HalfAngleDegrees,
+		const FCombatEntityQueryFilter& Filter, TArray<AActor*>& OutActors) const;
+
+	// Actors touched by a sphere moving from Start to End
+	UFUNCTION(BlueprintCallable, Category = "Spatial Hash")
+	void QuerySweptSphere(const FVector& Start, const FVector& End, float Radius,
+		const FCombatEntityQueryFilter& Filter, TArray<AActor*>& OutActors) const;
+
+	// Up to Count actors closest to Origin within MaxRadius, nearest first
+	UFUNCTION(BlueprintCallable, Category = "Spatial Hash")
+	void QueryKNearest(const FVector& Origin, int32 Count, float MaxRadius,
+		const FCombatEntityQueryFilter& Filter, TArray<AActor*>& OutActors) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	UPROPERTY()
+	TArray<FCombatSpatialEntry> Entries;
+
+	TMap<AActor*, int32> EntryIndices;
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	// Largest registered radius/half height, used to pad query bounds
+	float MaxEntryRadius = 0.0f;
+	float MaxEntryHalfHeight = 0.0f;
+
+	FIntPoint GetCell(const FVector& Location) const;
+	void RefreshBounds(FCombatSpatialEntry& Entry) const;
+	void AddToCell(const FIntPoint& Cell, int32 EntryIndex);
+	void RemoveFromCell(const FIntPoint& Cell, int32 EntryIndex);
+
+	bool PassesFilter(const FCombatSpatialEntry& Entry, const FCombatEntityQueryFilter& Filter) const;
+
+	// Visits every entry whose cell overlaps the 2D bounds padded by the largest entry radius
+	template <typename FunctorType>
+	void ForEachEntryInBounds(const FVector& Min, const FVector& Max, FunctorType&& Functor) const;
+
+	// Distance from a point to the entry's vertical capsule axis
+	static float DistanceToEntryAxis(const FVector& Point, const FCombatSpatialEntry& Entry);
+};
@@ -0,0 +1,97 @@
+// Cooldown Types - Cooldowns kept as absolute world-time expiry so nothing has to count them down
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+
+/**
+ * A single cooldown. Starting it records when it ends; checking it is one comparison
+ * against the world clock, so owners do no per-tick work while it runs.
+ */
+struct FCooldown
+{
+	double ExpiryTime = 0.0;
+
+	void Start(const UWorld* World, float Duration)
+	{
+		ExpiryTime = GetWorldTime(World) + Duration;
+	}
+
+	void Reset()
+	{
+		ExpiryTime = 0.0;
+	}
+
+	bool IsActive(const UWorld* World) const
+	{
+		return GetWorldTime(World) < ExpiryTime;
+	}
+
+	float GetRemaining(const UWorld* World) const
+	{
+		return static_cast<float>(FMath::Max(ExpiryTime - GetWorldTime(World), 0.0));
+	}
+
+	// Pushes a cooldown that was still running at PausedTime back by the time spent paused
+	void ShiftPaused(double PausedTime, double PausedDuration)
+	{
+		if (ExpiryTime > PausedTime)
+		{
+			ExpiryTime += PausedDuration;
+		}
+	}
+
+	static double GetWorldTime(const UWorld* World)
+	{
+		return World ? World->GetTimeSeconds() : 0.0;
+	}
+};
+
+/**
+ * Cooldowns for a fixed set of slots, e.g. the entries of an attack array, stored densely by
+ * slot index. Slots are grown on first use and never removed while the owner lives.
+ */
+struct FCooldownTable
+{
+	void Start(int32 Slot, const UWorld* World, float Duration)
+	{
+		if (Slot < 0) return;
+
+		if (Slot >= ExpiryTimes.Num())
+		{
+			ExpiryTimes.SetNumZeroed(Slot + 1);
+		}
+		ExpiryTimes[Slot] = FCooldown::GetWorldTime(World) + Duration;
+	}
+
+	void Reset()
+	{
+		ExpiryTimes.Reset();
+	}
+
+	bool IsActive(int32 Slot, const UWorld* World) const
+	{
+		return ExpiryTimes.IsValidIndex(Slot) && FCooldown::GetWorldTime(World) < ExpiryTimes[Slot];
+	}
+
+	float GetRemaining(int32 Slot, const UWorld* World) const
+	{
+		if (!ExpiryTimes.IsValidIndex(Slot)) return 0.0f;
+		return static_cast<float>(FMath::Max(ExpiryTimes[Slot] - FCooldown::GetWorldTime(World), 0.0));
+	}
+
+	void ShiftPaused(double PausedTime, double PausedDuration)
+	{
+		for (double& ExpiryTime : ExpiryTimes)
+		{
+			if (ExpiryTime > PausedTime)
+			{
+				ExpiryTime += PausedDuration;
+			}
+		}
+	}
+
+private:
+	TArray<double, TInlineAllocator<4>> ExpiryTimes;
+};
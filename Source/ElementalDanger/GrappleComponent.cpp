@@ -46,12 +46,6 @@ void UGrappleComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 
 	UpdateGrapple(DeltaTime);
 
-	// Update cooldown
-	if (CooldownTimer > 0.0f)
-	{
-		CooldownTimer -= DeltaTime;
-	}
-
 	// Update air combo window
 	if (bInAirCombo)
 	{
@@ -109,7 +103,7 @@ bool UGrappleComponent::ShootGrapple(FVector TargetLocation)
 		if (CurrentTarget.bIsValid)
 		{
 			ChangeState(EGrappleState::Shooting);
-			CooldownTimer = GrappleCooldown;
+			ShotCooldown.Start(GetWorld(), GrappleCooldown);
 
 			OnGrappleShot(GrappleEndLocation);
 
@@ -133,7 +127,7 @@ bool UGrappleComponent::ShootGrappleAtActor(AActor* TargetActor)
 bool UGrappleComponent::CanShootGrapple() const
 {
 	if (CurrentState != EGrappleState::Idle) return false;
-	if (CooldownTimer > 0.0f) return false;
+	if (ShotCooldown.IsActive(GetWorld())) return false;
 
 	return true;
 }
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "MagicTypes.h"
+#include "CooldownTypes.h"
 #include "GrappleComponent.generated.h"
 
 UENUM(BlueprintType)
@@ -263,7 +264,7 @@ protected:
 	// Tracking
 	// ============================================
 
-	float CooldownTimer = 0.0f;
+	FCooldown ShotCooldown;
 	float AirComboTimer = 0.0f;
 	bool bInAirCombo = false;
 
@@ -15,6 +15,9 @@
 #include "InventoryComponent.h"
 #include "InteractableInterface.h"
 #include "NinjaWizardHUD.h"
+#include "CombatSpatialHashSubsystem.h"
+#include "AIThreatMapSubsystem.h"
+#include "CombatProjectileSubsystem.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/SpringArmComponent.h"
@@ -121,6 +124,33 @@ void ANinjaWizardCharacter::BeginPlay()
 			}
 		}
 	}
+
+	// Make the player visible to AI proximity queries
+	if (UCombatSpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHashSubsystem>())
+	{
+		SpatialHash->RegisterActor(this, ECombatSpatialKind::Player);
+	}
+
+	// Creatures flee from the player's influence
+	if (UAIThreatMapSubsystem* ThreatMap = GetWorld()->GetSubsystem<UAIThreatMapSubsystem>())
+	{
+		ThreatMap->RegisterSource(this);
+	}
+}
+
+void ANinjaWizardCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UCombatSpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHashSubsystem>())
+	{
+		SpatialHash->UnregisterActor(this);
+	}
+
+	if (UAIThreatMapSubsystem* ThreatMap = GetWorld()->GetSubsystem<UAIThreatMapSubsystem>())
+	{
+		ThreatMap->UnregisterSource(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ANinjaWizardCharacter::Tick(float DeltaTime)
@@ -529,6 +559,20 @@ void ANinjaWizardCharacter::CastSelectedElement()
 	FVector SpawnLocation = GetActorLocation() + (GetActorForwardVector() * 100.0f) + FVector(0, 0, 50.0f);
 	FRotator SpawnRotation = GetControlRotation();
 
+	UCombatProjectileSubsystem* Projectiles = bSimulateMagicProjectile ? GetWorld()->GetSubsystem<UCombatProjectileSubsystem>() : nullptr;
+	if (Projectiles)
+	{
+		FCombatProjectileParams Params;
+		Params.Speed = MagicProjectileSpeed;
+		Params.Damage = SpellData.BaseDamage;
+		Params.Element = CurrentlySelectedElement;
+		Params.CosmeticClass = MagicProjectileClass;
+
+		Projectiles->LaunchProjectile(SpawnLocation, SpawnRotation.Vector(), Params, this);
+		UE_LOG(LogTemp, Log, TEXT("Cast %d element spell!"), (int32)CurrentlySelectedElement);
+		return;
+	}
+
 	FActorSpawnParameters SpawnParams;
 	SpawnParams.Owner = this;
 	SpawnParams.Instigator = this;
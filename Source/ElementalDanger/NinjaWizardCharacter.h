@@ -36,6 +36,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void Tick(float DeltaTime) override;
@@ -165,6 +166,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Magic|Projectile")
 	TSubclassOf<AActor> MagicProjectileClass;
 
+	// Fly the spell through the combat projectile subsystem and use MagicProjectileClass only for visuals.
+	// Disable for projectile blueprints that handle their own movement and impact.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Magic|Projectile")
+	bool bSimulateMagicProjectile = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Magic|Projectile", meta = (EditCondition = "bSimulateMagicProjectile"))
+	float MagicProjectileSpeed = 2000.0f;
+
 	UFUNCTION(BlueprintCallable, Category = "Magic")
 	void SetSelectedElement(EMagicElement Element);
 
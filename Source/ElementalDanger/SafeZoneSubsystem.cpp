@@ -0,0 +1,85 @@
+// Safe Zone Subsystem Implementation
+
+#include "SafeZoneSubsystem.h"
+#include "SafeZoneVolume.h"
+
+void USafeZoneSubsystem::Deinitialize()
+{
+	Zones.Empty();
+	Occupancy.Empty();
+
+	Super::Deinitialize();
+}
+
+bool USafeZoneSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+// ============================================
+// Registration
+// ============================================
+
+void USafeZoneSubsystem::RegisterZone(ASafeZoneVolume* Zone)
+{
+	if (!Zone) return;
+
+	Zones.AddUnique(Zone);
+}
+
+void USafeZoneSubsystem::UnregisterZone(ASafeZoneVolume* Zone)
+{
+	if (!Zone) return;
+
+	Zones.RemoveSwap(Zone);
+
+	// Drop the zone from every actor still recorded inside it
+	for (auto It = Occupancy.CreateIterator(); It; ++It)
+	{
+		It.Value().Remove(Zone);
+		if (It.Value().Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void USafeZoneSubsystem::NotifyActorEntered(ASafeZoneVolume* Zone, AActor* Actor)
+{
+	if (!Zone || !Actor) return;
+
+	auto& ActorZones = Occupancy.FindOrAdd(Actor);
+	ActorZones.Remove(Zone);
+	ActorZones.Add(Zone);
+}
+
+void USafeZoneSubsystem::NotifyActorExited(ASafeZoneVolume* Zone, AActor* Actor)
+{
+	if (!Zone || !Actor) return;
+
+	if (auto* ActorZones = Occupancy.Find(Actor))
+	{
+		ActorZones->Remove(Zone);
+		if (ActorZones->Num() == 0)
+		{
+			Occupancy.Remove(Actor);
+		}
+	}
+}
+
+// ============================================
+// Queries
+// ============================================
+
+bool USafeZoneSubsystem::IsActorInAnySafeZone(const AActor* Actor) const
+{
+	return Actor && Occupancy.Contains(Actor);
+}
+
+ASafeZoneVolume* USafeZoneSubsystem::GetSafeZoneForActor(const AActor* Actor) const
+{
+	if (!Actor) return nullptr;
+
+	const auto* ActorZones = Occupancy.Find(Actor);
+	return ActorZones && ActorZones->Num() > 0 ? ActorZones->Last().Get() : nullptr;
+}
@@ -0,0 +1,61 @@
+// Safe Zone Subsystem - Registry of safe zones and the players currently inside them
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "SafeZoneSubsystem.generated.h"
+
+class ASafeZoneVolume;
+
+/**
+ * Tracks which actors are inside which ASafeZoneVolume, driven by the zones' own overlap events.
+ * "Is this actor in any safe zone" is a single map lookup instead of a world actor scan.
+ */
+UCLASS()
+class ELEMENTALDANGER_API USafeZoneSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Deinitialize() override;
+
+	// ============================================
+	// Registration
+	// ============================================
+
+	void RegisterZone(ASafeZoneVolume* Zone);
+	void UnregisterZone(ASafeZoneVolume* Zone);
+
+	// Called by zones from their overlap events
+	void NotifyActorEntered(ASafeZoneVolume* Zone, AActor* Actor);
+	void NotifyActorExited(ASafeZoneVolume* Zone, AActor* Actor);
+
+	// ============================================
+	// Queries
+	// ============================================
+
+	UFUNCTION(BlueprintCallable, Category = "Safe Zone")
+	bool IsActorInAnySafeZone(const AActor* Actor) const;
+
+	// Zone the actor entered most recently, or nullptr
+	UFUNCTION(BlueprintCallable, Category = "Safe Zone")
+	ASafeZoneVolume* GetSafeZoneForActor(const AActor* Actor) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Safe Zone")
+	int32 GetNumRegisteredZones() const { return Zones.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	UPROPERTY()
+	TArray<ASafeZoneVolume*> Zones;
+
+	// Zones each actor is currently inside, most recent last
+	TMap<TObjectKey<AActor>, TArray<TWeakObjectPtr<ASafeZoneVolume>, TInlineAllocator<2>>> Occupancy;
+};
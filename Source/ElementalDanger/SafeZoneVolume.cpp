@@ -5,6 +5,7 @@
 #include "NinjaWizardCharacter.h"
 #include "CombatEntity.h"
 #include "AIBehaviorComponent.h"
+#include "SafeZoneSubsystem.h"
 #include "DrawDebugHelpers.h"
 
 ASafeZoneVolume::ASafeZoneVolume()
@@ -35,6 +36,35 @@ void ASafeZoneVolume::BeginPlay()
 	// Bind overlap events
 	SafeZoneBox->OnComponentBeginOverlap.AddDynamic(this, &ASafeZoneVolume::OnBeginOverlap);
 	SafeZoneBox->OnComponentEndOverlap.AddDynamic(this, &ASafeZoneVolume::OnEndOverlap);
+
+	USafeZoneSubsystem* SafeZones = GetWorld()->GetSubsystem<USafeZoneSubsystem>();
+	if (SafeZones)
+	{
+		SafeZones->RegisterZone(this);
+	}
+
+	// Players already inside when play began never raise a begin overlap
+	TArray<AActor*> OverlappingPlayers;
+	SafeZoneBox->GetOverlappingActors(OverlappingPlayers, ANinjaWizardCharacter::StaticClass());
+	for (AActor* Player : OverlappingPlayers)
+	{
+		PlayersInZone.AddUnique(Player);
+		if (SafeZones)
+		{
+			SafeZones->NotifyActorEntered(this, Player);
+		}
+	}
+}
+
+void ASafeZoneVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USafeZoneSubsystem* SafeZones = GetWorld()->GetSubsystem<USafeZoneSubsystem>())
+	{
+		SafeZones->UnregisterZone(this);
+	}
+	PlayersInZone.Empty();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ASafeZoneVolume::Tick(float DeltaTime)
@@ -100,6 +130,10 @@ void ASafeZoneVolume::OnBeginOverlap(UPrimitiveComponent* OverlappedComponent, A
 	if (ANinjaWizardCharacter* Player = Cast<ANinjaWizardCharacter>(OtherActor))
 	{
 		PlayersInZone.AddUnique(Player);
+		if (USafeZoneSubsystem* SafeZones = GetWorld()->GetSubsystem<USafeZoneSubsystem>())
+		{
+			SafeZones->NotifyActorEntered(this, Player);
+		}
 		OnPlayerEntered(Player);
 
 		UE_LOG(LogTemp, Log, TEXT("Player entered safe zone: %s"), *ZoneName);
@@ -129,6 +163,10 @@ void ASafeZoneVolume::OnEndOverlap(UPrimitiveComponent* OverlappedComponent, AAc
 	if (ANinjaWizardCharacter* Player = Cast<ANinjaWizardCharacter>(OtherActor))
 	{
 		PlayersInZone.Remove(Player);
+		if (USafeZoneSubsystem* SafeZones = GetWorld()->GetSubsystem<USafeZoneSubsystem>())
+		{
+			SafeZones->NotifyActorExited(this, Player);
+		}
 		OnPlayerExited(Player);
 
 		UE_LOG(LogTemp, Log, TEXT("Player exited safe zone: %s"), *ZoneName);
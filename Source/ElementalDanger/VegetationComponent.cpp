@@ -0,0 +1,50 @@
+// Vegetation Component Implementation
+
+#include "VegetationComponent.h"
+#include "VegetationSubsystem.h"
+
+UVegetationComponent::UVegetationComponent()
+{
+	// Vegetation is static, the registry holds everything queries need
+	PrimaryComponentTick.bCanEverTick = false;
+
+	MaxGrazers = 1;
+}
+
+void UVegetationComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UVegetationSubsystem* VegetationSubsystem = GetWorld()->GetSubsystem<UVegetationSubsystem>())
+	{
+		VegetationSubsystem->RegisterVegetation(this);
+	}
+}
+
+void UVegetationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UVegetationSubsystem* VegetationSubsystem = GetWorld()->GetSubsystem<UVegetationSubsystem>())
+	{
+		VegetationSubsystem->UnregisterVegetation(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+TArray<FName> UVegetationComponent::GetVegetationTags() const
+{
+	if (VegetationTags.Num() > 0 || !GetOwner())
+	{
+		return VegetationTags;
+	}
+
+	return GetOwner()->Tags;
+}
+
+void UVegetationComponent::RefreshLocation()
+{
+	if (UVegetationSubsystem* VegetationSubsystem = GetWorld()->GetSubsystem<UVegetationSubsystem>())
+	{
+		VegetationSubsystem->UpdateVegetationLocation(this);
+	}
+}
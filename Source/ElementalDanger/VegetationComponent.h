@@ -0,0 +1,44 @@
+// Vegetation Component - Marks an actor as food for grazing passive mobs
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "VegetationComponent.generated.h"
+
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class ELEMENTALDANGER_API UVegetationComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UVegetationComponent();
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+	// ============================================
+	// Configuration
+	// ============================================
+
+	// Matched against FPassiveBehaviorSettings::PreferredVegetationTags. Uses the owner's actor tags when empty.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vegetation")
+	TArray<FName> VegetationTags;
+
+	// How many grazers can eat here at once
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Vegetation")
+	int32 MaxGrazers = 1;
+
+	// ============================================
+	// Vegetation Functions
+	// ============================================
+
+	UFUNCTION(BlueprintCallable, Category = "Vegetation")
+	TArray<FName> GetVegetationTags() const;
+
+	// Call after moving the owner at runtime
+	UFUNCTION(BlueprintCallable, Category = "Vegetation")
+	void RefreshLocation();
+};
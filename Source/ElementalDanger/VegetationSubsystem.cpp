@@ -0,0 +1,283 @@
+// Vegetation Subsystem Implementation
+
+#include "VegetationSubsystem.h"
+#include "VegetationComponent.h"
+
+// ============================================
+// Subsystem
+// ============================================
+
+bool UVegetationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UVegetationSubsystem::Deinitialize()
+{
+	Entries.Empty();
+	FreeIndices.Empty();
+	EntryIndices.Empty();
+	TagCells.Empty();
+
+	Super::Deinitialize();
+}
+
+// ============================================
+// Registration
+// ============================================
+
+void UVegetationSubsystem::RegisterVegetation(UVegetationComponent* Vegetation)
+{
+	AActor* Owner = Vegetation ? Vegetation->GetOwner() : nullptr;
+	if (!Owner || EntryIndices.Contains(Owner)) return;
+
+	const int32 EntryIndex = FreeIndices.Num() > 0 ? FreeIndices.Pop(EAllowShrinking::No) : Entries.AddDefaulted();
+
+	FVegetationEntry& Entry = Entries[EntryIndex];
+	Entry = FVegetationEntry();
+	Entry.Actor = Owner;
+	Entry.Location = Owner->GetActorLocation();
+	Entry.Cell = GetCell(Entry.Location);
+	Entry.Capacity = FMath::Max(Vegetation->MaxGrazers, 1);
+	Entry.Tags.Append(Vegetation->GetVegetationTags());
+
+	EntryIndices.Add(Owner, EntryIndex);
+	AddToGrids(EntryIndex);
+}
+
+void UVegetationSubsystem::UnregisterVegetation(UVegetationComponent* Vegetation)
+{
+	AActor* Owner = Vegetation ? Vegetation->GetOwner() : nullptr;
+
+	int32 EntryIndex = INDEX_NONE;
+	if (!Owner || !EntryIndices.RemoveAndCopyValue(Owner, EntryIndex)) return;
+
+	RemoveFromGrids(EntryIndex);
+	Entries[EntryIndex] = FVegetationEntry();
+	FreeIndices.Add(EntryIndex);
+}
+
+void UVegetationSubsystem::UpdateVegetationLocation(UVegetationComponent* Vegetation)
+{
+	AActor* Owner = Vegetation ? Vegetation->GetOwner() : nullptr;
+	const int32* EntryIndex = Owner ? EntryIndices.Find(Owner) : nullptr;
+	if (!EntryIndex) return;
+
+	RemoveFromGrids(*EntryIndex);
+	Entries[*EntryIndex].Location = Owner->GetActorLocation();
+	Entries[*EntryIndex].Cell = GetCell(Entries[*EntryIndex].Location);
+	AddToGrids(*EntryIndex);
+}
+
+FIntPoint UVegetationSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+void UVegetationSubsystem::AddToGrids(int32 EntryIndex)
+{
+	const FVegetationEntry& Entry = Entries[EntryIndex];
+
+	TagCells.FindOrAdd(NAME_None).FindOrAdd(Entry.Cell).Add(EntryIndex);
+	for (const FName& Tag : Entry.Tags)
+	{
+		TagCells.FindOrAdd(Tag).FindOrAdd(Entry.Cell).AddUnique(EntryIndex);
+	}
+}
+
+void UVegetationSubsystem::RemoveFromGrids(int32 EntryIndex)
+{
+	const FVegetationEntry& Entry = Entries[EntryIndex];
+
+	auto RemoveFromGrid = [&](const FName& Tag)
+	{
+		TMap<FIntPoint, TArray<int32>>* Grid = TagCells.Find(Tag);
+		TArray<int32>* Cell = Grid ? Grid->Find(Entry.Cell) : nullptr;
+		if (!Cell) return;
+
+		Cell->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+		if (Cell->Num() == 0)
+		{
+			Grid->Remove(Entry.Cell);
+		}
+	};
+
+	RemoveFromGrid(NAME_None);
+	for (const FName& Tag : Entry.Tags)
+	{
+		RemoveFromGrid(Tag);
+	}
+}
+
+// ============================================
+// Queries
+// ============================================
+
+void UVegetationSubsystem::FindNearestVegetation(const FVector& Origin, const TArray<FName>& Tags, int32 Count, float MaxRadius,
+	bool bUnreservedOnly, TArray<AActor*>& OutVegetation) const
+{
+	OutVegetation.Reset();
+	if (Count <= 0 || MaxRadius <= 0.0f || EntryIndices.Num() == 0) return;
+
+	// Grids for the requested tags, or the all-vegetation grid
+	TArray<const TMap<FIntPoint, TArray<int32>>*, TInlineAllocator<4>> Grids;
+	if (Tags.Num() == 0)
+	{
+		if (const auto* Grid = TagCells.Find(NAME_None))
+		{
+			Grids.Add(Grid);
+		}
+	}
+	for (const FName& Tag : Tags)
+	{
+		if (const auto* Grid = TagCells.Find(Tag))
+		{
+			Grids.Add(Grid);
+		}
+	}
+	if (Grids.Num() == 0) return;
+
+	struct FCandidate
+	{
+		int32 EntryIndex;
+		float DistanceSq;
+	};
+	TArray<FCandidate, TInlineAllocator<16>> Candidates;
+
+	const float MaxRadiusSq = FMath::Square(MaxRadius);
+	const FIntPoint Center = GetCell(Origin);
+	const int32 MaxRing = FMath::CeilToInt(MaxRadius / CellSize);
+
+	auto VisitCell = [&](const FIntPoint& Cell)
+	{
+		for (const auto* Grid : Grids)
+		{
+			const TArray<int32>* Indices = Grid->Find(Cell);
+			if (!Indices) continue;
+
+			for (int32 EntryIndex : *Indices)
+			{
+				const FVegetationEntry& Entry = Entries[EntryIndex];
+				if (bUnreservedOnly && !HasCapacity(Entry)) continue;
+
+				const float DistanceSq = FVector::DistSquared(Origin, Entry.Location);
+				if (DistanceSq > MaxRadiusSq) continue;
+
+				// Entries with several matching tags are in several grids
+				if (Grids.Num() > 1 && Candidates.ContainsByPredicate([EntryIndex](const FCandidate& C) { return C.EntryIndex == EntryIndex; }))
+				{
+					continue;
+				}
+
+				Candidates.Add({ EntryIndex, DistanceSq });
+			}
+		}
+	};
+
+	// Expand one ring of cells at a time until nothing outside can be closer than the Count-th hit
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		if (Ring == 0)
+		{
+			VisitCell(Center);
+		}
+		else
+		{
+			for (int32 X = -Ring; X <= Ring; ++X)
+			{
+				VisitCell(Center + FIntPoint(X, -Ring));
+				VisitCell(Center + FIntPoint(X, Ring));
+			}
+			for (int32 Y = -Ring + 1; Y <= Ring - 1; ++Y)
+			{
+				VisitCell(Center + FIntPoint(-Ring, Y));
+				VisitCell(Center + FIntPoint(Ring, Y));
+			}
+		}
+
+		if (Candidates.Num() >= Count)
+		{
+			Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.DistanceSq < B.DistanceSq; });
+			if (Candidates[Count - 1].DistanceSq <= FMath::Square(Ring * CellSize))
+			{
+				break;
+			}
+		}
+	}
+
+	Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.DistanceSq < B.DistanceSq; });
+
+	const int32 NumResults = FMath::Min(Count, Candidates.Num());
+	for (int32 Index = 0; Index < NumResults; ++Index)
+	{
+		if (AActor* Actor = Entries[Candidates[Index].EntryIndex].Actor.Get())
+		{
+			OutVegetation.Add(Actor);
+		}
+	}
+}
+
+AActor* UVegetationSubsystem::FindAndReserveNearestVegetation(const FVector& Origin, const TArray<FName>& Tags, float MaxRadius, UObject* Reserver)
+{
+	TArray<AActor*> Found;
+	FindNearestVegetation(Origin, Tags, 1, MaxRadius, true, Found);
+
+	if (Found.Num() > 0 && ReserveVegetation(Found[0], Reserver))
+	{
+		return Found[0];
+	}
+
+	return nullptr;
+}
+
+// ============================================
+// Reservations
+// ============================================
+
+bool UVegetationSubsystem::ReserveVegetation(AActor* Vegetation, UObject* Reserver)
+{
+	const int32* EntryIndex = Vegetation ? EntryIndices.Find(Vegetation) : nullptr;
+	if (!EntryIndex || !Reserver) return false;
+
+	FVegetationEntry& Entry = Entries[*EntryIndex];
+	PruneReservers(Entry);
+
+	if (Entry.Reservers.Contains(Reserver)) return true;
+	if (Entry.Reservers.Num() >= Entry.Capacity) return false;
+
+	Entry.Reservers.Add(Reserver);
+	return true;
+}
+
+void UVegetationSubsystem::ReleaseVegetation(AActor* Vegetation, UObject* Reserver)
+{
+	const int32* EntryIndex = Vegetation ? EntryIndices.Find(Vegetation) : nullptr;
+	if (!EntryIndex) return;
+
+	FVegetationEntry& Entry = Entries[*EntryIndex];
+	Entry.Reservers.Remove(Reserver);
+	PruneReservers(Entry);
+}
+
+bool UVegetationSubsystem::IsVegetationAvailable(AActor* Vegetation) const
+{
+	const int32* EntryIndex = Vegetation ? EntryIndices.Find(Vegetation) : nullptr;
+	return EntryIndex && HasCapacity(Entries[*EntryIndex]);
+}
+
+bool UVegetationSubsystem::HasCapacity(const FVegetationEntry& Entry) const
+{
+	int32 ActiveReservations = 0;
+	for (const TWeakObjectPtr<UObject>& Reserver : Entry.Reservers)
+	{
+		ActiveReservations += Reserver.IsValid() ? 1 : 0;
+	}
+
+	return ActiveReservations < Entry.Capacity;
+}
+
+void UVegetationSubsystem::PruneReservers(FVegetationEntry& Entry)
+{
+	// Grazers destroyed without releasing
+	Entry.Reservers.RemoveAllSwap([](const TWeakObjectPtr<UObject>& Reserver) { return !Reserver.IsValid(); });
+}
@@ -0,0 +1,110 @@
+// Vegetation Subsystem - Tag-indexed spatial registry of grazeable vegetation with reservations
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "VegetationSubsystem.generated.h"
+
+class UVegetationComponent;
+
+/**
+ * A registered piece of vegetation
+ */
+struct FVegetationEntry
+{
+	TWeakObjectPtr<AActor> Actor;
+	FVector Location = FVector::ZeroVector;
+	FIntPoint Cell = FIntPoint::ZeroValue;
+	TArray<FName, TInlineAllocator<2>> Tags;
+
+	// Grazers that may reserve this at once
+	int32 Capacity = 1;
+	TArray<TWeakObjectPtr<UObject>, TInlineAllocator<1>> Reservers;
+};
+
+/**
+ * Registry of UVegetationComponent owners, indexed by tag in uniform 2D grids.
+ * Vegetation registers itself on BeginPlay, so queries never iterate world actors.
+ * Grazers reserve what they are walking to so a herd spreads over nearby bushes.
+ */
+UCLASS(Config=Game)
+class ELEMENTALDANGER_API UVegetationSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================
+	// Subsystem
+	// ============================================
+
+	virtual void Deinitialize() override;
+
+	// ============================================
+	// Configuration
+	// ============================================
+
+	// Edge length of a grid cell in world units
+	UPROPERTY(Config, BlueprintReadOnly, Category = "Vegetation")
+	float CellSize = 2000.0f;
+
+	// ============================================
+	// Registration
+	// ============================================
+
+	void RegisterVegetation(UVegetationComponent* Vegetation);
+	void UnregisterVegetation(UVegetationComponent* Vegetation);
+
+	// Re-indexes vegetation that was moved after registering
+	void UpdateVegetationLocation(UVegetationComponent* Vegetation);
+
+	UFUNCTION(BlueprintCallable, Category = "Vegetation")
+	int32 GetNumRegistered() const { return EntryIndices.Num(); }
+
+	// ============================================
+	// Queries
+	// ============================================
+
+	/**
+	 * Up to Count vegetation actors nearest to Origin within MaxRadius, nearest first.
+	 * Matches any of Tags, or any vegetation when Tags is empty.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Vegetation")
+	void FindNearestVegetation(const FVector& Origin, const TArray<FName>& Tags, int32 Count, float MaxRadius,
+		bool bUnreservedOnly, TArray<AActor*>& OutVegetation) const;
+
+	// Nearest unreserved match, already reserved for Reserver
+	UFUNCTION(BlueprintCallable, Category = "Vegetation")
+	AActor* FindAndReserveNearestVegetation(const FVector& Origin, const TArray<FName>& Tags, float MaxRadius, UObject* Reserver);
+
+	// ============================================
+	// Reservations
+	// ============================================
+
+	UFUNCTION(BlueprintCallable, Category = "Vegetation")
+	bool ReserveVegetation(AActor* Vegetation, UObject* Reserver);
+
+	UFUNCTION(BlueprintCallable, Category = "Vegetation")
+	void ReleaseVegetation(AActor* Vegetation, UObject* Reserver);
+
+	UFUNCTION(BlueprintCallable, Category = "Vegetation")
+	bool IsVegetationAvailable(AActor* Vegetation) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	// Slots are reused, a free slot has no actor
+	TArray<FVegetationEntry> Entries;
+	TArray<int32> FreeIndices;
+	TMap<TObjectKey<AActor>, int32> EntryIndices;
+
+	// Per tag grid of entry indices, NAME_None indexes every entry
+	TMap<FName, TMap<FIntPoint, TArray<int32>>> TagCells;
+
+	FIntPoint GetCell(const FVector& Location) const;
+	void AddToGrids(int32 EntryIndex);
+	void RemoveFromGrids(int32 EntryIndex);
+	bool HasCapacity(const FVegetationEntry& Entry) const;
+	static void PruneReservers(FVegetationEntry& Entry);
+};
@@ -5,6 +5,7 @@
 #include "InventoryComponent.h"
 #include "NinjaWizardCharacter.h"
 #include "CombatEntity.h"
+#include "CombatSpatialHashSubsystem.h"
 #include "DrawDebugHelpers.h"
 #include "Kismet/KismetMathLibrary.h"
 
@@ -275,38 +276,20 @@ void UWeaponReturnComponent::CheckWeaponCollisions(FThrownWeaponData& WeaponData
 {
 	if (!GetWorld()) return;
 
-	// Sphere trace for enemies
-	TArray<FHitResult> HitResults;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(OwnerCharacter);
-	if (WeaponData.ThrownWeaponActor)
-	{
-		QueryParams.AddIgnoredActor(WeaponData.ThrownWeaponActor);
-	}
+	UCombatSpatialHashSubsystem* SpatialHash = GetWorld()->GetSubsystem<UCombatSpatialHashSubsystem>();
+	if (!SpatialHash) return;
 
-	bool bHit = GetWorld()->SweepMultiByChannel(
-		HitResults,
-		StartPos,
-		EndPos,
-		FQuat::Identity,
-		ECC_Pawn,
-		FCollisionShape::MakeSphere(CollisionRadius),
-		QueryParams
-	);
+	// Swept sphere against enemies only (don't damage player summons)
+	FCombatEntityQueryFilter Filter;
+	Filter.bIncludeSummons = false;
+	Filter.IgnoredActor = OwnerCharacter;
 
-	if (bHit)
+	TArray<AActor*> HitEnemies;
+	SpatialHash->QuerySweptSphere(StartPos, EndPos, CollisionRadius, Filter, HitEnemies);
+
+	for (AActor* Enemy : HitEnemies)
 	{
-		for (const FHitResult& Hit : HitResults)
-		{
-			if (ACombatEntity* Enemy = Cast<ACombatEntity>(Hit.GetActor()))
-			{
-				// Don't damage player summons
-				if (!Enemy->bIsPlayerSummon)
-				{
-					DealDamageToEnemy(Enemy, WeaponData);
-				}
-			}
-		}
+		DealDamageToEnemy(Enemy, WeaponData);
 	}
 }
 